@@ -0,0 +1,342 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   benchIO.cpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file benchIO.cpp
+ * @brief Benchmark of the IEventIO backends, built and run by `make bench-io`.
+ *
+ * For every backend and descriptor count, N socketpairs are created and
+ * their read ends registered. Two scenarios are timed:
+ * - "wait": each round makes M descriptors readable, then wait(0) and a
+ *   dispatch reading every reported descriptor are timed;
+ * - "churn": each round removes and re-adds M descriptors, then a wait(0)
+ *   applies the changes; the add/remove calls and that wait are timed.
+ *
+ * Results are written as CSV, one row per backend, scenario and size:
+ * backend,scenario,fds,active,rounds,ns_per_round,syscalls_per_round
+ *
+ * Usage: bench_io [-b select,poll,epoll,io_uring] [-n 10,100,1000,10000,100000]
+ *                 [-a active] [-r rounds]
+ */
+
+#include <common/core/io/EventFactoryIO.hpp>
+#include <common/core/io/IEventIO.hpp>
+#include <common/core/raii/UniquePtr.hpp>
+#include <common/core/utils/timeUtils.hpp>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+using common::core::io::EventFactoryIO;
+using common::core::io::IEventIO;
+using common::core::raii::UniquePtr;
+using common::core::utils::monotonicNano;
+
+namespace
+{
+
+/// Time budget of one scenario, in nanoseconds, before rounds are cut short.
+const unsigned long	BUDGET_NS = 2000000000UL;
+
+/**
+ * @struct Config
+ * @brief Command line options.
+ */
+struct Config
+{
+	std::vector<std::string>	backends; ///< Backends to run, as accepted by EventFactoryIO
+	std::vector<std::size_t>	sizes;    ///< Numbers of monitored descriptors
+	std::size_t					active;   ///< Descriptors made ready or churned per round
+	std::size_t					rounds;   ///< Rounds per scenario, at most
+};
+
+/**
+ * @class Pairs
+ * @brief Owns N non-blocking socketpairs, read end first.
+ */
+class Pairs
+{
+	public:
+		Pairs() : _fds() {}
+		~Pairs() { close(); }
+
+		/**
+		 * @brief Creates the socketpairs.
+		 *
+		 * @param count Number of socketpairs.
+		 * @return false if the descriptor limit was reached.
+		 */
+		bool	open(std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				int sv[2];
+
+				if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sv) == -1)
+					return (false);
+				_fds.push_back(sv[0]);
+				_fds.push_back(sv[1]);
+			}
+			return (true);
+		}
+
+		void	close()
+		{
+			for (std::size_t i = 0; i < _fds.size(); ++i)
+				::close(_fds[i]);
+			_fds.clear();
+		}
+
+		std::size_t	size() const { return (_fds.size() / 2); }
+		int			reader(std::size_t i) const { return (_fds[2 * i]); }
+		int			writer(std::size_t i) const { return (_fds[2 * i + 1]); }
+
+	private:
+		Pairs(const Pairs &rhs);
+		Pairs &operator=(const Pairs &rhs);
+
+		std::vector<int>	_fds;
+};
+
+/**
+ * @struct Result
+ * @brief Totals of one scenario.
+ */
+struct Result
+{
+	std::size_t		rounds;   ///< Rounds actually run
+	unsigned long	ns;       ///< Time spent in the timed section
+	unsigned long	syscalls; ///< Backend system calls in the timed section
+};
+
+std::vector<std::string>	split(const std::string &list)
+{
+	std::vector<std::string> items;
+	std::string::size_type start = 0;
+	std::string::size_type end;
+
+	while ((end = list.find(',', start)) != std::string::npos)
+	{
+		items.push_back(list.substr(start, end - start));
+		start = end + 1;
+	}
+	items.push_back(list.substr(start));
+	return (items);
+}
+
+bool	parse(int argc, char **argv, Config &cfg)
+{
+	const char *defaultSizes[] = {"10", "100", "1000", "10000", "100000"};
+
+	cfg.backends = split("select,poll,epoll,io_uring");
+	cfg.sizes.clear();
+	for (std::size_t i = 0; i < sizeof(defaultSizes) / sizeof(*defaultSizes); ++i)
+		cfg.sizes.push_back(std::strtoul(defaultSizes[i], NULL, 10));
+	cfg.active = 16;
+	cfg.rounds = 2000;
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		std::string opt(argv[i]);
+
+		if (opt == "-b")
+			cfg.backends = split(argv[i + 1]);
+		else if (opt == "-n")
+		{
+			std::vector<std::string> sizes = split(argv[i + 1]);
+
+			cfg.sizes.clear();
+			for (std::size_t j = 0; j < sizes.size(); ++j)
+				cfg.sizes.push_back(std::strtoul(sizes[j].c_str(), NULL, 10));
+		}
+		else if (opt == "-a")
+			cfg.active = std::strtoul(argv[i + 1], NULL, 10);
+		else if (opt == "-r")
+			cfg.rounds = std::strtoul(argv[i + 1], NULL, 10);
+		else
+			return (false);
+	}
+	return (argc % 2 == 1 && cfg.active > 0 && cfg.rounds > 0);
+}
+
+/**
+ * @brief Raises the soft descriptor limit to the hard one.
+ */
+void	raiseFdLimit()
+{
+	struct rlimit rl;
+
+	if (::getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < rl.rlim_max)
+	{
+		rl.rlim_cur = rl.rlim_max;
+		::setrlimit(RLIMIT_NOFILE, &rl);
+	}
+}
+
+/**
+ * @brief Reads what every reported descriptor holds, like a handler would.
+ */
+void	dispatch(const IEventIO &io)
+{
+	char buf[64];
+
+	for (IEventIO::ReadyList::const_iterator it = io.getReady().begin(); it != io.getReady().end(); ++it)
+		if (it->events & IEventIO::E_IN)
+			while (::read(it->fd, buf, sizeof(buf)) > 0)
+				;
+}
+
+Result	benchWait(IEventIO &io, const Pairs &pairs, std::size_t active, std::size_t rounds)
+{
+	Result res = {0, 0, 0};
+	unsigned long syscalls = io.getSyscalls();
+	std::size_t next = 0;
+	char byte = 0;
+
+	for (; res.rounds < rounds && res.ns < BUDGET_NS; ++res.rounds)
+	{
+		unsigned long start;
+
+		for (std::size_t i = 0; i < active; ++i, next = (next + 1) % pairs.size())
+			if (::write(pairs.writer(next), &byte, 1) == -1)
+				throw std::runtime_error("write failed: " + std::string(std::strerror(errno)));
+		start = monotonicNano();
+		io.wait(0);
+		dispatch(io);
+		res.ns += monotonicNano() - start;
+	}
+	res.syscalls = io.getSyscalls() - syscalls;
+	return (res);
+}
+
+Result	benchChurn(IEventIO &io, const Pairs &pairs, std::size_t active, std::size_t rounds)
+{
+	Result res = {0, 0, 0};
+	unsigned long syscalls = io.getSyscalls();
+	std::size_t next = 0;
+
+	for (; res.rounds < rounds && res.ns < BUDGET_NS; ++res.rounds)
+	{
+		unsigned long start = monotonicNano();
+
+		for (std::size_t i = 0; i < active; ++i, next = (next + 1) % pairs.size())
+		{
+			io.remove(pairs.reader(next));
+			io.add(pairs.reader(next), IEventIO::E_IN);
+		}
+		io.wait(0);
+		res.ns += monotonicNano() - start;
+	}
+	res.syscalls = io.getSyscalls() - syscalls;
+	return (res);
+}
+
+void	report(const std::string &backend, const char *scenario, std::size_t fds, std::size_t active, const Result &res)
+{
+	std::printf("%s,%s,%lu,%lu,%lu,%lu,%.2f\n", backend.c_str(), scenario,
+		static_cast<unsigned long>(fds), static_cast<unsigned long>(active),
+		static_cast<unsigned long>(res.rounds), res.rounds ? res.ns / res.rounds : 0,
+		res.rounds ? static_cast<double>(res.syscalls) / static_cast<double>(res.rounds) : 0.0);
+	std::fflush(stdout);
+}
+
+/**
+ * @brief Runs both scenarios for one backend and size.
+ *
+ * @return false if the size could not be set up.
+ */
+bool	run(const std::string &backend, std::size_t fds, const Config &cfg)
+{
+	Pairs pairs;
+	std::size_t active = cfg.active < fds ? cfg.active : fds;
+	std::string resolved = EventFactoryIO::resolve(backend, fds);
+
+	if (resolved != backend)
+	{
+		std::fprintf(stderr, "# %s: unavailable, would run %s\n", backend.c_str(), resolved.c_str());
+		return (false);
+	}
+	if (pairs.open(fds) == false)
+	{
+		std::fprintf(stderr, "# %s,%lu: descriptor limit reached\n", backend.c_str(), static_cast<unsigned long>(fds));
+		return (false);
+	}
+	UniquePtr<IEventIO> io(EventFactoryIO::create(backend));
+	for (std::size_t i = 0; i < pairs.size(); ++i)
+		io->add(pairs.reader(i), IEventIO::E_IN);
+	io->wait(0);
+	report(backend, "wait", fds, active, benchWait(*io, pairs, active, cfg.rounds));
+	report(backend, "churn", fds, active, benchChurn(*io, pairs, active, cfg.rounds));
+	return (true);
+}
+
+} // !namespace
+
+int	main(int argc, char **argv)
+{
+	Config cfg;
+
+	if (parse(argc, argv, cfg) == false)
+	{
+		std::fprintf(stderr, "usage: %s [-b backends] [-n sizes] [-a active] [-r rounds]\n", argv[0]);
+		return (2);
+	}
+	raiseFdLimit();
+	std::printf("backend,scenario,fds,active,rounds,ns_per_round,syscalls_per_round\n");
+	try
+	{
+		for (std::size_t b = 0; b < cfg.backends.size(); ++b)
+			for (std::size_t n = 0; n < cfg.sizes.size(); ++n)
+				run(cfg.backends[b], cfg.sizes[n], cfg);
+	}
+	catch (const std::exception &e)
+	{
+		std::fprintf(stderr, "bench_io: %s\n", e.what());
+		return (1);
+	}
+	return (0);
+}
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
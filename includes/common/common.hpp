@@ -21,13 +21,40 @@
  * to provide convenient access to commonly used components throughout the project.
  */
 
+#include <common/core/io/AcceptMutex.hpp>
+#include <common/core/io/AEventLoop.hpp>
+#include <common/core/io/AOffloadTask.hpp>
+#include <common/core/io/ATask.hpp>
+#include <common/core/io/BasicEventLoop.hpp>
+#include <common/core/io/DynamicEventIO.hpp>
+#include <common/core/io/EpollEventIO.hpp>
 #include <common/core/io/EventFactoryIO.hpp>
+#include <common/core/io/EventLoop.hpp>
+#include <common/core/io/EventLoopGroup.hpp>
+#include <common/core/io/FdTable.hpp>
+#include <common/core/io/IdleTracker.hpp>
+#include <common/core/io/IEventHandler.hpp>
 #include <common/core/io/IEventIO.hpp>
+#include <common/core/io/IIdleHandler.hpp>
+#include <common/core/io/InstrumentedHandler.hpp>
+#include <common/core/io/IOutputHandler.hpp>
+#include <common/core/io/ITimerHandler.hpp>
+#include <common/core/io/IoUring.hpp>
+#include <common/core/io/IoUringCompletionIO.hpp>
+#include <common/core/io/IoUringEventIO.hpp>
+#include <common/core/io/OutputQueue.hpp>
 #include <common/core/io/PollEventIO.hpp>
 #include <common/core/io/SelectEventIO.hpp>
+#include <common/core/io/TaskQueue.hpp>
+#include <common/core/io/ThreadPool.hpp>
+#include <common/core/io/TimerWheel.hpp>
+#include <common/core/io/WakeupChannel.hpp>
+#include <common/core/io/WorkDeque.hpp>
 
 #include <common/core/net/address/GetNameInfo.hpp>
 #include <common/core/net/address/GetAddrinfo.hpp>
+#include <common/core/net/sockets/IAcceptHandler.hpp>
+#include <common/core/net/sockets/ShardedTcpServer.hpp>
 #include <common/core/net/sockets/TcpClient.hpp>
 #include <common/core/net/sockets/TcpServer.hpp>
 
@@ -40,6 +67,7 @@
 #include <common/core/utils/algoUtils.hpp>
 #include <common/core/utils/Directory.hpp>
 #include <common/core/utils/fileUtils.hpp>
+#include <common/core/utils/Histogram.hpp>
 #include <common/core/utils/stringUtils.hpp>
 #include <common/core/utils/timeUtils.hpp>
 #include <common/core/utils/urlUtils.hpp>
@@ -0,0 +1,283 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   AEventLoop.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_AEVENTLOOP_HPP
+#define COMMON_AEVENTLOOP_HPP
+
+/**
+ * @file AEventLoop.hpp
+ * @brief Backend-independent part of the reactor.
+ */
+
+#include <common/core/io/ATask.hpp>
+#include <common/core/io/IEventHandler.hpp>
+#include <common/core/io/IEventIO.hpp>
+#include <common/core/io/TaskQueue.hpp>
+#include <common/core/io/TimerWheel.hpp>
+#include <common/core/io/WakeupChannel.hpp>
+#include <common/core/utils/Histogram.hpp>
+#include <cstddef>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+class OutputQueue;
+
+/**
+ * @class AEventLoop
+ * @brief State and operations of a reactor that do not depend on its
+ * backend.
+ *
+ * Holds the timer wheel, the posted task queue and its wakeup channel,
+ * the counters and histograms returned by getStats(), the dispatch cap,
+ * the busy-poll tuning and the list of output queues to flush. BasicEventLoop adds the backend and the
+ * iteration; keeping this part out of the template compiles it once for
+ * every backend.
+ *
+ * Descriptor registration is virtual, so that code given an AEventLoop,
+ * such as an IAcceptHandler or an AOffloadTask, works with every
+ * BasicEventLoop. The iteration is not: waits and dispatch keep calling
+ * the backend directly.
+ *
+ * Only constructed as the base of a BasicEventLoop.
+ *
+ * @startuml
+ * abstract class "AEventLoop" as AEventLoop {
+		# _timers : TimerWheel
+		# _wakeup : WakeupChannel
+		# _tasks : TaskQueue
+		# _stats : Stats
+		# _readyHistogram : Histogram
+		# _dispatchHistogram : Histogram
+		# _instrumented : bool
+		# _busyPollMax : unsigned long
+		# _busyPollBudget : unsigned long
+		# _interArrival : unsigned long
+		# _lastArrival : unsigned long
+		# _cursor : size_t
+		# _maxEvents : size_t
+		# _running : bool
+		- _deferredHead : OutputQueue*
+		- _deferredTail : OutputQueue*
+		--
+		# AEventLoop()
+		# waitTimeout(timeout_ms : int) : int
+		# adapt(now : unsigned long) : void
+		# snapshot(stats : Stats&) : void
+		# flushDeferred() : size_t
+		# {static} dispatch(event : ReadyEvent) : void
+		# {static} count(counter : unsigned long&, n : size_t) : void
+		+ {abstract} add(fd : int, mask : e_Event, handler : IEventHandler*) : void
+		+ {abstract} update(fd : int, mask : e_Event) : void
+		+ {abstract} remove(fd : int) : void
+		+ schedule(timer : Timer&, delay_ms : unsigned long) : void
+		+ cancel(timer : Timer&) : void
+		+ post(task : ATask*) : void
+		+ wakeup() : void
+		+ stop() : void
+		+ isRunning() : bool
+		+ setInstrumented(enabled : bool) : void
+		+ isInstrumented() : bool
+		+ setBusyPoll(max_us : unsigned long) : void
+		+ getBusyPoll() : unsigned long
+		+ setMaxEvents(max : size_t) : void
+		+ getMaxEvents() : size_t
+		+ getTimers() : TimerWheel&
+		+ defer(queue : OutputQueue&) : void
+		+ undefer(queue : OutputQueue&) : void
+	}
+ * @enduml
+ */
+class AEventLoop
+{
+	public:
+		/**
+		 * @struct Stats
+		 * @brief Counters of the work done by a loop.
+		 *
+		 * @startuml
+		 * struct "Stats" as Stats {
+				iterations : unsigned long
+				events : unsigned long
+				timers : unsigned long
+				tasks : unsigned long
+				waits : unsigned long
+				waitTime : unsigned long
+				dispatchTime : unsigned long
+				syscalls : unsigned long
+				busyPolls : unsigned long
+				busyPollHits : unsigned long
+				flushes : unsigned long
+				readyPerWait : Histogram::Snapshot
+				dispatchLatency : Histogram::Snapshot
+				--
+				Stats()
+			}
+		 * @enduml
+		 */
+		struct Stats
+		{
+			unsigned long	iterations;   ///< Calls to runOnce()
+			unsigned long	events;       ///< Events dispatched to handlers
+			unsigned long	timers;       ///< Timers fired
+			unsigned long	tasks;        ///< Posted tasks run
+			unsigned long	waits;        ///< Calls to IEventIO::wait()
+			unsigned long	waitTime;     ///< Nanoseconds spent in wait(), if instrumented
+			unsigned long	dispatchTime; ///< Nanoseconds spent in handlers, if instrumented
+			unsigned long	syscalls;     ///< System calls made by the backend
+			unsigned long	busyPolls;    ///< Zero-timeout waits of the spin phase
+			unsigned long	busyPollHits; ///< Spin phases that found events
+			unsigned long	flushes;      ///< Deferred output queue flushes
+			utils::Histogram::Snapshot	readyPerWait;    ///< Ready events returned by each wait()
+			utils::Histogram::Snapshot	dispatchLatency; ///< Nanoseconds per event, if instrumented
+
+			Stats();
+		};
+
+		virtual void	add(int fd, IEventIO::e_Event mask, IEventHandler *handler) = 0;
+		virtual void	update(int fd, IEventIO::e_Event mask) = 0;
+		virtual void	remove(int fd) = 0;
+
+		void			schedule(Timer &timer, unsigned long delay_ms);
+		void			cancel(Timer &timer);
+
+		void			post(ATask *task);
+		void			wakeup();
+
+		void			stop();
+		bool			isRunning() const;
+
+		void			setInstrumented(bool enabled);
+		bool			isInstrumented() const;
+		void			setBusyPoll(unsigned long max_us);
+		unsigned long	getBusyPoll() const;
+		void			setMaxEvents(std::size_t max);
+		std::size_t		getMaxEvents() const;
+		TimerWheel		&getTimers();
+
+		void			defer(OutputQueue &queue);
+		void			undefer(OutputQueue &queue);
+
+	protected:
+		AEventLoop();
+		virtual ~AEventLoop();
+
+		/// Default cap on the number of events dispatched per iteration.
+		static const std::size_t	DEFAULT_MAX_EVENTS = 256;
+
+		int			waitTimeout(int timeout_ms) const;
+		void		adapt(unsigned long now);
+		void		snapshot(Stats &stats) const;
+		std::size_t	flushDeferred();
+
+		static void	dispatch(const IEventIO::ReadyEvent &event);
+		static void	count(unsigned long &counter, std::size_t n);
+
+		TimerWheel			_timers;
+		WakeupChannel		_wakeup;
+		TaskQueue			_tasks;
+		Stats				_stats;
+		utils::Histogram	_readyHistogram;
+		utils::Histogram	_dispatchHistogram;
+		bool				_instrumented;
+		unsigned long		_busyPollMax;
+		unsigned long		_busyPollBudget;
+		unsigned long		_interArrival;
+		unsigned long		_lastArrival;
+		std::size_t			_cursor;
+		std::size_t			_maxEvents;
+		bool				_running;
+
+	private:
+		AEventLoop(const AEventLoop &rhs);
+		AEventLoop &operator=(const AEventLoop &rhs);
+
+		OutputQueue			*_deferredHead;
+		OutputQueue			*_deferredTail;
+};
+
+/**
+ * @brief Calls the handler callbacks matching a ready event.
+ *
+ * The event entry lives in the backend's ready list, which blanks it to
+ * E_NONE when the descriptor is removed: the remaining callbacks are
+ * skipped as soon as a handler unregisters its descriptor. Defined here
+ * so that each BasicEventLoop inlines it in its dispatch loop.
+ *
+ * @param event Ready event carrying the handler as user pointer.
+ */
+inline void	AEventLoop::dispatch(const IEventIO::ReadyEvent &event)
+{
+	IEventHandler *handler = static_cast<IEventHandler *>(event.data);
+	IEventIO::e_Event events = event.events;
+
+	if (handler == NULL)
+		return ;
+	if (events & IEventIO::E_IN)
+		handler->onRead(event.fd);
+	if ((events & IEventIO::E_OUT) && event.events != IEventIO::E_NONE)
+		handler->onWrite(event.fd);
+	if ((events & IEventIO::E_EXCEPT) && event.events != IEventIO::E_NONE)
+		handler->onError(event.fd);
+}
+
+/**
+ * @brief Adds to a counter read by other threads.
+ *
+ * The loop thread is the only writer, so a relaxed load and store are
+ * enough to publish the value without a locked instruction.
+ *
+ * @param counter Counter to increase.
+ * @param n Amount to add.
+ */
+inline void	AEventLoop::count(unsigned long &counter, std::size_t n)
+{
+	if (n)
+		__atomic_store_n(&counter, counter + n, __ATOMIC_RELAXED);
+}
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_AEVENTLOOP_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
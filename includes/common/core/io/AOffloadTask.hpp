@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   AOffloadTask.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_AOFFLOADTASK_HPP
+#define COMMON_AOFFLOADTASK_HPP
+
+/**
+ * @file AOffloadTask.hpp
+ * @brief Task run on a ThreadPool and completed on its originating loop.
+ */
+
+#include <common/core/io/ATask.hpp>
+#include <common/core/io/AEventLoop.hpp>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class AOffloadTask
+ * @brief Two-phase task moving CPU work off an event loop.
+ *
+ * Submitted to a ThreadPool, it runs execute() on a worker thread, then
+ * posts itself back to the loop it was created for, where complete()
+ * runs. The result of execute() is therefore handed to the loop thread
+ * without locking. complete() may delete the task.
+ *
+ * @startuml
+ * abstract class "AOffloadTask" as AOffloadTask {
+		- _origin : AEventLoop*
+		- _executed : bool
+		--
+		+ AOffloadTask(origin : AEventLoop&)
+		+ run() : void
+		+ getOrigin() : AEventLoop&
+		+ {abstract} execute() : void
+		+ {abstract} complete() : void
+	}
+ * @enduml
+ */
+class AOffloadTask : public ATask
+{
+	public:
+		explicit AOffloadTask(AEventLoop &origin);
+		virtual ~AOffloadTask();
+
+		void			run();
+		AEventLoop		&getOrigin() const;
+
+		virtual void	execute() = 0;
+		virtual void	complete() = 0;
+
+	private:
+		AOffloadTask(const AOffloadTask &rhs);
+		AOffloadTask &operator=(const AOffloadTask &rhs);
+
+		AEventLoop	*_origin;
+		bool		_executed;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_AOFFLOADTASK_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ATask.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_ATASK_HPP
+#define COMMON_ATASK_HPP
+
+/**
+ * @file ATask.hpp
+ * @brief Base class for units of work handed to an EventLoop thread.
+ */
+
+#include <cstddef>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class ATask
+ * @brief Unit of work posted to a TaskQueue.
+ *
+ * Carries the link used by the queue, so posting never allocates. The
+ * queue does not own the task: run() may delete it, and it must not be
+ * posted again before it has run.
+ *
+ * @startuml
+ * abstract class "ATask" as ATask {
+		- _next : ATask*
+		--
+		+ ATask()
+		+ {abstract} run() : void
+	}
+ * @enduml
+ */
+class ATask
+{
+	public:
+		ATask() : _next(NULL) {};
+		virtual ~ATask() {};
+
+		virtual void	run() = 0;
+
+	private:
+		friend class TaskQueue;
+
+		ATask(const ATask &rhs);
+		ATask &operator=(const ATask &rhs);
+
+		ATask	*_next;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_ATASK_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   AcceptMutex.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_ACCEPTMUTEX_HPP
+#define COMMON_ACCEPTMUTEX_HPP
+
+/**
+ * @file AcceptMutex.hpp
+ * @brief Lock shared by worker processes to take turns on a listening
+ * socket.
+ */
+
+#include <pthread.h>
+#include <sys/types.h>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class AcceptMutex
+ * @brief Inter-process try-lock deciding which worker monitors a shared
+ * listening socket.
+ *
+ * When worker processes inherit one listening socket and all register it
+ * on their loop, every connection wakes all of them and only one accepts
+ * it. Where E_EXCLUSIVE is not honoured (see
+ * EventFactoryIO::supportsExclusive()), the workers can instead take
+ * turns: only the worker holding the mutex monitors the socket, the
+ * others remove it from their loop and wait with a short timeout before
+ * trying again, like the accept_mutex of nginx.
+ *
+ * The lock lives in an anonymous shared mapping, so the mutex must be
+ * created before fork(), and it is never blocking. On Linux it is a
+ * robust process-shared pthread mutex: when its holder dies without
+ * unlocking, the kernel hands it to the next tryLock() with EOWNERDEAD,
+ * which takes it over whatever became of the pid. Robust mutexes belong
+ * to a thread, so the lock is held by the thread that took it, typically
+ * the loop thread: tryLock() from another thread of the same process
+ * fails, and unlock() from it does nothing. Other platforms hold the lock
+ * per process, only store the pid of the holder and probe it with
+ * kill(2), which cannot tell a dead holder whose pid was reused.
+ *
+ * Usage:
+ * @code
+ * AcceptMutex mutex; // before fork()
+ * // in each worker
+ * bool listening = false;
+ * while (running)
+ * {
+ *     if (mutex.tryLock() != listening)
+ *     {
+ *         listening = !listening;
+ *         if (listening)
+ *             loop.add(server.getFd(), IEventIO::E_IN, &acceptor);
+ *         else
+ *             loop.remove(server.getFd());
+ *     }
+ *     loop.runOnce(listening ? -1 : 500);
+ *     mutex.unlock();
+ * }
+ * @endcode
+ *
+ * @startuml
+ * class "AcceptMutex" as AcceptMutex {
+		- _state : State*
+		--
+		+ AcceptMutex()
+		+ tryLock() : bool
+		+ unlock() : void
+		+ isHeld() : bool
+		+ getOwner() : pid_t
+	}
+ * @enduml
+ */
+class AcceptMutex
+{
+	public:
+		AcceptMutex();
+		~AcceptMutex();
+
+		bool	tryLock();
+		void	unlock();
+		bool	isHeld() const;
+		pid_t	getOwner() const;
+
+	private:
+		/**
+		 * @struct State
+		 * @brief Lock shared by the processes, in the anonymous mapping.
+		 */
+		struct State
+		{
+#if defined(__linux__)
+			pthread_mutex_t	mutex; ///< Robust process-shared mutex
+#endif
+			pid_t			owner; ///< Pid of the holder, 0 if free
+#if defined(__linux__)
+			pid_t			thread; ///< Thread id of the holder, 0 if free
+#endif
+		};
+
+		AcceptMutex(const AcceptMutex &rhs);
+		AcceptMutex &operator=(const AcceptMutex &rhs);
+
+		State	*_state;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_ACCEPTMUTEX_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,412 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   BasicEventLoop.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_BASICEVENTLOOP_HPP
+#define COMMON_BASICEVENTLOOP_HPP
+
+/**
+ * @file BasicEventLoop.hpp
+ * @brief Reactor dispatching the events of a backend bound at compile time.
+ */
+
+#include <common/core/io/AEventLoop.hpp>
+#include <common/core/io/IEventHandler.hpp>
+#include <common/core/io/IEventIO.hpp>
+#include <common/core/utils/timeUtils.hpp>
+#include <cstddef>
+#include <stdexcept>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class BasicEventLoop
+ * @brief Single-threaded reactor built on a backend held by value.
+ *
+ * Registers one IEventHandler per descriptor, passed to the backend as
+ * the descriptor's user pointer. Each iteration dispatches straight from
+ * the backend's ready list: E_IN calls onRead(), E_OUT calls onWrite()
+ * and E_EXCEPT calls onError(), in that order.
+ *
+ * The backend is a member, not a pointer: with a concrete class such as
+ * EpollEventIO, every backend call is a direct call the compiler may
+ * inline, including the inline getReady() and the event mask
+ * translations, and the loop allocates no backend on the heap. EventLoop
+ * is the instantiation on DynamicEventIO, which keeps choosing the
+ * backend by name at run time.
+ *
+ * At most getMaxEvents() events are dispatched per iteration. Events left
+ * over are dispatched by the next iterations before waiting again, so a
+ * burst of activity cannot starve the work done between iterations.
+ *
+ * Timers are kept on a TimerWheel driven by the monotonic clock. The
+ * next deadline bounds the timeout passed to the backend's wait(), and
+ * expired timers run after each wait, before the I/O callbacks.
+ *
+ * post(), wakeup() and stop() may be called from any thread. Posted
+ * tasks are queued without locking and run by the loop thread at the end
+ * of the iteration; a WakeupChannel registered on the backend interrupts
+ * a blocking wait as soon as the first task of a batch is posted.
+ * getStats() may also be called from any thread.
+ *
+ * Output queued on an attached OutputQueue is flushed after the tasks,
+ * once per iteration and queue, so the responses produced by one batch
+ * of events leave in one gathered write per connection.
+ *
+ * getStats() returns a snapshot of the loop counters, the distribution
+ * of ready events per wait and the backend syscall count. With
+ * setInstrumented(true), each iteration also reads the monotonic clock
+ * around the wait and after every dispatched event (a vDSO call, no
+ * system call), adding the time blocked in wait versus the time spent in
+ * handlers and the per-event dispatch latency. Per-handler latencies are
+ * collected by wrapping a handler in an InstrumentedHandler.
+ *
+ * setBusyPoll() enables a spin phase for latency-sensitive loops: before
+ * blocking, the loop polls the backend with a zero timeout for up to a
+ * budget, sparing the sleep and wakeup of the thread when an event
+ * arrives meanwhile. The budget tracks a moving average of the time
+ * between wakeups that found events: twice that average, capped by the
+ * configured maximum, or no spin at all while events arrive less often
+ * than the maximum, so an idle loop blocks at once.
+ *
+ * Usage:
+ * @code
+ * BasicEventLoop<EpollEventIO> loop;
+ * loop.add(server.getFd(), IEventIO::E_IN, &acceptor);
+ * loop.run();
+ * @endcode
+ *
+ * @tparam Backend Backend class held by the loop: an IEventIO
+ *         implementation or DynamicEventIO, default constructible or
+ *         constructible from the argument given to the loop.
+ *
+ * @startuml
+ * class "BasicEventLoop<Backend>" as BasicEventLoopBackend <<template>> {
+		- _io : Backend
+		--
+		- poll(timeout_ms : int) : void
+		+ BasicEventLoop()
+		+ BasicEventLoop(arg : Arg)
+		+ add(fd : int, mask : e_Event, handler : IEventHandler*) : void
+		+ update(fd : int, mask : e_Event) : void
+		+ remove(fd : int) : void
+		+ runOnce(timeout_ms : int) : size_t
+		+ run() : void
+		+ getStats() : Stats
+		+ getEventIO() : Backend&
+	}
+ * AEventLoop <|-- BasicEventLoopBackend
+ * @enduml
+ */
+template<typename Backend>
+class BasicEventLoop : public AEventLoop
+{
+	public:
+		BasicEventLoop();
+		template<typename Arg>
+		explicit BasicEventLoop(const Arg &arg);
+		~BasicEventLoop();
+
+		void		add(int fd, IEventIO::e_Event mask, IEventHandler *handler);
+		void		update(int fd, IEventIO::e_Event mask);
+		void		remove(int fd);
+
+		std::size_t	runOnce(int timeout_ms);
+		void		run();
+
+		Stats		getStats() const;
+		Backend		&getEventIO();
+
+	private:
+		BasicEventLoop(const BasicEventLoop &rhs);
+		BasicEventLoop &operator=(const BasicEventLoop &rhs);
+
+		void	poll(int timeout_ms);
+
+		Backend	_io;
+};
+
+/**
+ * @brief Default constructor. Creates the backend and registers the
+ * wakeup channel on it.
+ *
+ * @tparam Backend Backend class held by the loop.
+ * @throw std::runtime_error If the backend or the channel cannot be created.
+ */
+template<typename Backend>
+BasicEventLoop<Backend>::BasicEventLoop() : AEventLoop(), _io()
+{
+	_io.add(_wakeup.getFd(), IEventIO::E_IN, &_wakeup);
+}
+
+/**
+ * @brief Constructor passing one argument to the backend constructor,
+ * such as the type name of a DynamicEventIO.
+ *
+ * @tparam Backend Backend class held by the loop.
+ * @tparam Arg Type of the backend constructor argument.
+ * @param arg Backend constructor argument.
+ * @throw std::runtime_error If the backend or the channel cannot be created.
+ */
+template<typename Backend>
+template<typename Arg>
+BasicEventLoop<Backend>::BasicEventLoop(const Arg &arg) : AEventLoop(), _io(arg)
+{
+	_io.add(_wakeup.getFd(), IEventIO::E_IN, &_wakeup);
+}
+
+/**
+ * @brief Destructor. The backend is destroyed with the loop.
+ *
+ * @tparam Backend Backend class held by the loop.
+ */
+template<typename Backend>
+BasicEventLoop<Backend>::~BasicEventLoop() {}
+
+/**
+ * @brief Registers a handler for a file descriptor.
+ *
+ * @tparam Backend Backend class held by the loop.
+ * @param fd File descriptor to monitor.
+ * @param mask Event mask to monitor.
+ * @param handler Handler receiving the descriptor events, not owned.
+ * @throw std::runtime_error If handler is NULL or the backend rejects fd.
+ */
+template<typename Backend>
+void	BasicEventLoop<Backend>::add(int fd, IEventIO::e_Event mask, IEventHandler *handler)
+{
+	if (handler == NULL)
+		throw std::runtime_error("EventLoop: NULL handler");
+	_io.add(fd, mask, handler);
+}
+
+/**
+ * @brief Changes the event mask of a registered descriptor, keeping its handler.
+ *
+ * @tparam Backend Backend class held by the loop.
+ * @param fd File descriptor to update.
+ * @param mask New event mask.
+ */
+template<typename Backend>
+void	BasicEventLoop<Backend>::update(int fd, IEventIO::e_Event mask)
+{
+	_io.update(fd, mask);
+}
+
+/**
+ * @brief Unregisters a descriptor.
+ *
+ * Safe to call from a handler: events of the descriptor that are still
+ * pending in the current batch are dropped.
+ *
+ * @tparam Backend Backend class held by the loop.
+ * @param fd File descriptor to remove.
+ */
+template<typename Backend>
+void	BasicEventLoop<Backend>::remove(int fd)
+{
+	_io.remove(fd);
+}
+
+/**
+ * @brief Runs one iteration of the loop.
+ *
+ * Waits for events only when the previous batch has been fully
+ * dispatched, with a timeout shortened to the next timer deadline. Then
+ * runs the expired timers, dispatches up to getMaxEvents() events and
+ * runs the posted tasks. Last, flushes the output queues deferred during
+ * the iteration. When instrumented, the wait and each dispatched
+ * event are timed. With busy polling enabled, the wait starts with a
+ * spin phase (see poll()).
+ *
+ * @tparam Backend Backend class held by the loop.
+ * @param timeout_ms Longest time to wait for events (-1 for infinite).
+ * @return Number of events dispatched, timers and tasks run.
+ */
+template<typename Backend>
+std::size_t	BasicEventLoop<Backend>::runOnce(int timeout_ms)
+{
+	const IEventIO::ReadyList &ready = _io.getReady();
+	const bool instrumented = isInstrumented();
+	std::size_t timers = 0;
+	std::size_t events = 0;
+	std::size_t tasks;
+	std::size_t flushes;
+	unsigned long start = 0;
+	unsigned long dispatched = 0;
+
+	if (_cursor >= ready.size())
+	{
+		_cursor = 0;
+		timers += _timers.advance(utils::monotonicMilli());
+		timeout_ms = timers ? 0 : waitTimeout(timeout_ms);
+		if (instrumented)
+			start = utils::monotonicNano();
+		poll(timeout_ms);
+		if (instrumented)
+			count(_stats.waitTime, utils::monotonicNano() - start);
+	}
+	timers += _timers.advance(utils::monotonicMilli());
+	if (instrumented)
+		start = utils::monotonicNano();
+	while (_cursor < ready.size() && events < _maxEvents)
+	{
+		const IEventIO::ReadyEvent &event = ready[_cursor++];
+		if (event.events == IEventIO::E_NONE)
+			continue ;
+		dispatch(event);
+		++events;
+		if (instrumented)
+		{
+			unsigned long end = utils::monotonicNano();
+
+			_dispatchHistogram.record(end - start);
+			dispatched += end - start;
+			start = end;
+		}
+	}
+	count(_stats.dispatchTime, dispatched);
+	tasks = _tasks.run();
+	flushes = flushDeferred();
+	count(_stats.iterations, 1);
+	count(_stats.events, events);
+	count(_stats.timers, timers);
+	count(_stats.tasks, tasks);
+	count(_stats.flushes, flushes);
+	return (timers + events + tasks);
+}
+
+/**
+ * @brief Runs iterations until stop() is called.
+ *
+ * @tparam Backend Backend class held by the loop.
+ */
+template<typename Backend>
+void	BasicEventLoop<Backend>::run()
+{
+	__atomic_store_n(&_running, true, __ATOMIC_RELEASE);
+	while (__atomic_load_n(&_running, __ATOMIC_ACQUIRE))
+		runOnce(-1);
+}
+
+/**
+ * @brief Gets a snapshot of the loop counters. Safe from any thread.
+ *
+ * @tparam Backend Backend class held by the loop.
+ * @return Counters since construction.
+ */
+template<typename Backend>
+typename BasicEventLoop<Backend>::Stats	BasicEventLoop<Backend>::getStats() const
+{
+	Stats stats;
+
+	snapshot(stats);
+	stats.syscalls = _io.getSyscalls();
+	return (stats);
+}
+
+/**
+ * @brief Gets the backend used by the loop.
+ *
+ * @tparam Backend Backend class held by the loop.
+ * @return Backend reference.
+ */
+template<typename Backend>
+Backend	&BasicEventLoop<Backend>::getEventIO()
+{
+	return (_io);
+}
+
+/**
+ * @brief Waits for events, spinning first if busy polling is enabled.
+ *
+ * The spin phase calls the backend's wait(0) until events show up or the
+ * current budget runs out, never longer than a positive timeout_ms. Only
+ * then does the loop block for timeout_ms. Each wait returning events
+ * feeds adapt().
+ *
+ * @tparam Backend Backend class held by the loop.
+ * @param timeout_ms Timeout of the blocking wait (-1 for infinite).
+ */
+template<typename Backend>
+void	BasicEventLoop<Backend>::poll(int timeout_ms)
+{
+	const IEventIO::ReadyList &ready = _io.getReady();
+	const unsigned long max = __atomic_load_n(&_busyPollMax, __ATOMIC_RELAXED);
+	unsigned long now = 0;
+	bool found = false;
+
+	if (max > 0 && timeout_ms != 0)
+	{
+		unsigned long budget = _busyPollBudget < max ? _busyPollBudget : max;
+
+		if (timeout_ms > 0 && budget > static_cast<unsigned long>(timeout_ms) * 1000000UL)
+			budget = static_cast<unsigned long>(timeout_ms) * 1000000UL;
+		now = utils::monotonicNano();
+		for (const unsigned long deadline = now + budget; found == false && now < deadline; now = utils::monotonicNano())
+		{
+			_io.wait(0);
+			count(_stats.waits, 1);
+			count(_stats.busyPolls, 1);
+			found = ready.empty() == false;
+		}
+		if (found)
+			count(_stats.busyPollHits, 1);
+	}
+	if (found == false)
+	{
+		_io.wait(timeout_ms);
+		count(_stats.waits, 1);
+		if (max > 0)
+			now = utils::monotonicNano();
+	}
+	_readyHistogram.record(ready.size());
+	if (max > 0 && ready.empty() == false)
+		adapt(now);
+}
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_BASICEVENTLOOP_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
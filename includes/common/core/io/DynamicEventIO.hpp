@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   DynamicEventIO.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_DYNAMICEVENTIO_HPP
+#define COMMON_DYNAMICEVENTIO_HPP
+
+/**
+ * @file DynamicEventIO.hpp
+ * @brief Backend adapter selecting its IEventIO implementation at run time.
+ */
+
+#include <common/core/io/IEventIO.hpp>
+#include <common/core/raii/UniquePtr.hpp>
+#include <cstddef>
+#include <string>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class DynamicEventIO
+ * @brief Thin adapter giving a BasicEventLoop an IEventIO created by
+ * EventFactoryIO.
+ *
+ * BasicEventLoop holds its backend by value and calls it directly. This
+ * adapter is the backend of EventLoop: it owns the implementation picked
+ * by name and forwards every call to it through IEventIO, keeping the
+ * runtime choice at the cost of one heap allocation and one virtual call
+ * per operation.
+ *
+ * @startuml
+ * class "DynamicEventIO" as DynamicEventIO {
+		- _io : UniquePtr<IEventIO>
+		--
+		+ DynamicEventIO(type : string)
+		+ wait(timeout_ms : int) : int
+		+ add(fd : int, mask : e_Event, data : void*) : void
+		+ remove(fd : int) : void
+		+ update(fd : int, mask : e_Event) : void
+		+ update(fd : int, mask : e_Event, data : void*) : void
+		+ flush() : void
+		+ clear() : void
+		+ getEvents(fd : int) : e_Event
+		+ getReady() : ReadyList
+		+ getSyscalls() : unsigned long
+		+ get() : IEventIO&
+	}
+ * @enduml
+ */
+class DynamicEventIO
+{
+	public:
+		explicit DynamicEventIO(const std::string &type);
+		~DynamicEventIO();
+
+		int		wait(int timeout_ms) { return (_io->wait(timeout_ms)); }
+		void	add(int fd, IEventIO::e_Event mask, void *data = NULL) { _io->add(fd, mask, data); }
+		void	remove(int fd) { _io->remove(fd); }
+		void	update(int fd, IEventIO::e_Event mask) { _io->update(fd, mask); }
+		void	update(int fd, IEventIO::e_Event mask, void *data) { _io->update(fd, mask, data); }
+		void	flush() { _io->flush(); }
+		void	clear() { _io->clear(); }
+
+		IEventIO::e_Event			getEvents(int fd) const { return (_io->getEvents(fd)); }
+		const IEventIO::ReadyList	&getReady() const { return (_io->getReady()); }
+		unsigned long				getSyscalls() const { return (_io->getSyscalls()); }
+		IEventIO					&get() { return (*_io); }
+
+	private:
+		DynamicEventIO(const DynamicEventIO &rhs);
+		DynamicEventIO &operator=(const DynamicEventIO &rhs);
+
+		common::core::raii::UniquePtr<IEventIO>	_io;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_DYNAMICEVENTIO_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
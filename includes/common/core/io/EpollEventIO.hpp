@@ -0,0 +1,265 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   EpollEventIO.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_EPOLLEVENTIO_HPP
+#define COMMON_EPOLLEVENTIO_HPP
+
+/**
+ * @file EpollEventIO.hpp
+ * @brief IEventIO implementation based on epoll(7) (Linux only).
+ */
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <vector>
+#include <stdint.h>
+#include <sys/epoll.h>
+#include <common/core/io/FdTable.hpp>
+#include <common/core/io/IEventIO.hpp>
+#include <common/core/raii/UniqueFd.hpp>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class EpollEventIO
+ * @brief I/O event handler using the epoll(7) interface.
+ *
+ * Unlike select(2) and poll(2), the interest set is registered once in the
+ * kernel and wait() only returns the descriptors that are actually ready.
+ * The cost of an iteration therefore depends on the number of ready
+ * descriptors, not on the number of monitored ones.
+ *
+ * add(), update() and remove() only record the wanted state of the
+ * descriptor and queue it once in a changelist. flush(), called by
+ * wait(), compares each queued descriptor with what the kernel holds and
+ * issues at most one epoll_ctl(2) for it: later updates override earlier
+ * ones, an add() followed by a remove() costs nothing, and updates that
+ * leave the mask unchanged are dropped. epoll has no batched form of
+ * epoll_ctl(2), so the saving is in the calls avoided.
+ *
+ * @note Only available on Linux.
+ *
+ * @startuml
+ * class "EpollEventIO" as EpollEventIO {
+		- _epfd : UniqueFd
+		- _events : FdTable<Entry>
+		- _ready : ReadyList
+		- _epevents : vector<epoll_event>
+		- _changes : vector<int>
+		--
+		- queue(fd : int, entry : Entry&) : void
+		- apply(fd : int, entry : Entry&) : void
+		- ctl(op : int, fd : int, mask : e_Event) : int
+		- processResults(count : int) : void
+		- {static} eventToMask(event : e_Event) : uint32_t
+		- {static} maskToEvent(mask : uint32_t) : e_Event
+		+ EpollEventIO()
+		+ wait(timeout_ms : int) : int
+		+ add(fd : int, mask : e_Event, data : void*) : void
+		+ remove(fd : int) : void
+		+ update(fd : int, mask : e_Event) : void
+		+ update(fd : int, mask : e_Event, data : void*) : void
+		+ flush() : void
+		+ clear() : void
+		+ getEvents(fd : int) : e_Event
+		+ getReady() : ReadyList
+		+ getSyscalls() : unsigned long
+	}
+ * @enduml
+ */
+class EpollEventIO : public IEventIO
+{
+	public:
+		EpollEventIO();
+		~EpollEventIO();
+
+		int		wait(int timeout_ms);
+		void	add(int fd, e_Event mask, void *data = NULL);
+		void	remove(int fd);
+		void	update(int fd, e_Event mask);
+		void	update(int fd, e_Event mask, void *data);
+		void	flush();
+		void	clear();
+
+		e_Event getEvents(int fd) const;
+		const ReadyList &getReady() const;
+		unsigned long getSyscalls() const;
+
+	private:
+		/**
+		 * @struct Entry
+		 * @brief Registration state of a monitored descriptor.
+		 *
+		 * @startuml
+		 * struct "Entry" as Entry {
+				events : e_Event
+				ready : e_Event
+				kernel : e_Event
+				data : void*
+				active : bool
+				registered : bool
+				queued : bool
+				--
+				Entry()
+			}
+		 * @enduml
+		 */
+		struct Entry
+		{
+			e_Event	events;     ///< Wanted event mask, modifiers included
+			e_Event	ready;      ///< Events reported by the last wait()
+			e_Event	kernel;     ///< Mask armed in the kernel, E_NONE once fired if oneshot
+			void	*data;      ///< User pointer returned with each ReadyEvent
+			bool	active;     ///< Cleared by remove() until the change is flushed
+			bool	registered; ///< Present in the kernel interest list
+			bool	queued;     ///< Listed in the changelist
+
+			Entry();
+		};
+
+		EpollEventIO(const EpollEventIO &rhs);
+		EpollEventIO &operator=(const EpollEventIO &rhs);
+
+		/// Upper bound on the number of events retrieved by a single epoll_wait(2).
+		static const std::size_t	MAX_EVENTS = 1024;
+
+		void			queue(int fd, Entry &entry);
+		void			apply(int fd, Entry &entry);
+		int				ctl(int op, int fd, e_Event mask);
+		void			processResults(int count);
+
+		static uint32_t	eventToMask(e_Event event);
+		static e_Event	maskToEvent(uint32_t mask);
+
+		common::core::raii::UniqueFd		_epfd;
+		FdTable<Entry>						_events;
+		ReadyList							_ready;
+		std::vector<struct epoll_event>		_epevents;
+		std::vector<int>					_changes;
+		unsigned long						_syscalls;
+};
+
+/**
+ * @brief Gets the descriptors reported by the last wait().
+ *
+ * @return Ready list, valid until the next wait() or clear().
+ */
+inline const IEventIO::ReadyList &EpollEventIO::getReady() const
+{
+	return (_ready);
+}
+
+/**
+ * @brief Gets the number of system calls made by wait() and flush().
+ *
+ * @return Syscall count since construction. Safe from any thread.
+ */
+inline unsigned long EpollEventIO::getSyscalls() const
+{
+	return (__atomic_load_n(&_syscalls, __ATOMIC_RELAXED));
+}
+
+/**
+ * @brief Converts IEventIO event mask to epoll(7) event mask.
+ *
+ * EPOLLERR and EPOLLHUP are always reported by the kernel, E_EXCEPT only
+ * adds EPOLLPRI for out-of-band data, like the exception set of select(2).
+ * E_EDGE and E_ONESHOT are honoured natively as EPOLLET and EPOLLONESHOT.
+ * E_EXCLUSIVE becomes EPOLLEXCLUSIVE, which the kernel refuses along
+ * with EPOLLPRI or EPOLLONESHOT: it is dropped when combined with
+ * E_EXCEPT or E_ONESHOT.
+ *
+ * @param event IEventIO event mask.
+ * @return Corresponding epoll(7) event mask.
+ */
+inline uint32_t EpollEventIO::eventToMask(e_Event event)
+{
+	uint32_t mask = 0;
+
+	if (event & E_IN)
+		mask |= EPOLLIN;
+	if (event & E_OUT)
+		mask |= EPOLLOUT;
+	if (event & E_EXCEPT)
+		mask |= EPOLLPRI;
+	if (event & E_EDGE)
+		mask |= EPOLLET;
+	if (event & E_ONESHOT)
+		mask |= EPOLLONESHOT;
+#if defined(EPOLLEXCLUSIVE)
+	if ((event & E_EXCLUSIVE) && !(event & (E_EXCEPT | E_ONESHOT)))
+		mask |= EPOLLEXCLUSIVE;
+#endif
+
+	return (mask);
+}
+
+/**
+ * @brief Converts epoll(7) event mask to IEventIO event mask.
+ *
+ * @param mask epoll(7) event mask.
+ * @return Corresponding IEventIO event mask.
+ */
+inline IEventIO::e_Event EpollEventIO::maskToEvent(uint32_t mask)
+{
+	e_Event event = E_NONE;
+
+	if (mask & EPOLLIN)
+		event = static_cast<e_Event>(event | E_IN);
+	if (mask & EPOLLOUT)
+		event = static_cast<e_Event>(event | E_OUT);
+	if (mask & (EPOLLERR | EPOLLHUP | EPOLLPRI))
+		event = static_cast<e_Event>(event | E_EXCEPT);
+
+	return (event);
+}
+
+} // !io
+} // !core
+} // !common
+
+#endif // __linux__
+
+#endif // !COMMON_EPOLLEVENTIO_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
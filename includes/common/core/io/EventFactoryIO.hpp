@@ -20,7 +20,9 @@
 
 #include <common/core/io/IEventIO.hpp>
 #include <common/core/raii/UniquePtr.hpp>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace common
 {
@@ -34,9 +36,24 @@ namespace io
  * @brief Factory for creating I/O event handlers.
  *
  * This factory allows dynamic creation of different IEventIO implementations
- * (select, poll) based on a type string. The returned pointer must be managed
+ * (select, poll, epoll, io_uring) based on a type string. The returned pointer must be managed
  * by the caller, ideally via a UniquePtr.
  *
+ * The "auto" type picks the implementation from the platform and the
+ * expected number of descriptors: select for tiny sets when the
+ * descriptor limit is within FD_SETSIZE, epoll otherwise on Linux, poll
+ * elsewhere. calibrate() can instead time every available backend,
+ * select included, on a socketpair workload once at startup; "auto" then
+ * returns the fastest one for expected counts within CALIBRATION_SPREAD
+ * times the calibrated one, or unknown, and keeps the heuristic for
+ * loads of another order. "io_uring" quietly degrades to epoll on
+ * kernels that cannot run IoUringEventIO.
+ *
+ * supportsExclusive() tells whether the implementation a type resolves
+ * to honours E_EXCLUSIVE. Worker processes sharing a listening socket
+ * register it with E_EXCLUSIVE when it does, and take turns on an
+ * AcceptMutex otherwise.
+ *
  * @note In C++98, the factory returns a raw pointer because UniquePtr with explicit
  *       constructor cannot be returned directly without move semantics.
  *
@@ -49,15 +66,26 @@ namespace io
  * @startuml
  * class "EventFactoryIO" as EventFactoryIO [[classcommon_1_1core_1_1io_1_1_event_factory_i_o.html]] {
 		--
-		+ {static} createEventIO(type : e_Type) : IEventIO*
+		+ {static} create(type : string, expected_fds : size_t) : IEventIO*
+		+ {static} resolve(type : string, expected_fds : size_t) : string
+		+ {static} calibrate(fds : size_t, rounds : size_t) : string
+		+ {static} supportsExclusive(type : string, expected_fds : size_t) : bool
 		- EventFactoryIO()
+		- {static} stringToType(type : string) : e_Type
+		- {static} typeToString(type : e_Type) : string
+		- {static} pickAuto(expected_fds : size_t) : e_Type
+		- {static} fallback(type : e_Type) : e_Type
+		- {static} measure(type : e_Type, fds : vector<int>, rounds : size_t) : unsigned long
 	}
  * @enduml
  */
 class EventFactoryIO
 {
 	public:
-		static IEventIO* create(const std::string &type);
+		static IEventIO		*create(const std::string &type, std::size_t expected_fds = 0);
+		static std::string	resolve(const std::string &type, std::size_t expected_fds = 0);
+		static std::string	calibrate(std::size_t fds = 64, std::size_t rounds = 256);
+		static bool			supportsExclusive(const std::string &type, std::size_t expected_fds = 0);
 
 	private:
 		/**
@@ -68,12 +96,18 @@ class EventFactoryIO
 		 * enum "e_Type" as e_Type {
 			SELECT
 			POLL
+			EPOLL
+			IO_URING
+			AUTO
 		}
 		 * @enduml
 		 */
 		enum e_Type {
-			SELECT, ///< Implementation based on select(2)
-			POLL,   ///< Implementation based on poll(2)
+			SELECT,   ///< Implementation based on select(2)
+			POLL,     ///< Implementation based on poll(2)
+			EPOLL,    ///< Implementation based on epoll(7), Linux only
+			IO_URING, ///< Implementation based on io_uring(7), epoll if unsupported
+			AUTO,     ///< Best implementation available, see resolve()
 		};
 
 		EventFactoryIO();
@@ -81,7 +115,21 @@ class EventFactoryIO
 		EventFactoryIO(const EventFactoryIO &rhs);
 		EventFactoryIO &operator=(const EventFactoryIO &rhs);
 
-		static e_Type stringToType(const std::string type);
+		/// Largest expected descriptor count for which "auto" picks select(2).
+		static const std::size_t	SELECT_MAX_FDS = 8;
+		/// Largest ratio between the calibrated and expected descriptor counts for which "auto" trusts calibrate().
+		static const std::size_t	CALIBRATION_SPREAD = 8;
+
+		static e_Type			stringToType(const std::string type);
+		static std::string		typeToString(e_Type type);
+		static e_Type			pickAuto(std::size_t expected_fds);
+		static e_Type			fallback(e_Type type);
+		static unsigned long	measure(e_Type type, const std::vector<int> &fds, std::size_t rounds);
+
+		/// Backend elected by calibrate(), -1 before calibration.
+		static int				_calibrated;
+		/// Descriptor count of the calibrate() workload, 0 before calibration.
+		static std::size_t		_calibratedFds;
 };
 
 } // !io
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   EventLoop.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_EVENTLOOP_HPP
+#define COMMON_EVENTLOOP_HPP
+
+/**
+ * @file EventLoop.hpp
+ * @brief Reactor whose backend is chosen by name at run time.
+ */
+
+#include <common/core/io/BasicEventLoop.hpp>
+#include <common/core/io/DynamicEventIO.hpp>
+#include <common/core/io/IEventIO.hpp>
+#include <string>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class EventLoop
+ * @brief BasicEventLoop on a DynamicEventIO, the backend being created by
+ * EventFactoryIO from its type name.
+ *
+ * This is the loop used by EventLoopGroup, ShardedTcpServer and the
+ * accept and offload interfaces. Code that knows its backend at compile
+ * time can use BasicEventLoop directly and skip the virtual calls.
+ *
+ * Usage:
+ * @code
+ * EventLoop loop("epoll");
+ * loop.add(server.getFd(), IEventIO::E_IN, &acceptor);
+ * loop.run();
+ * @endcode
+ *
+ * @startuml
+ * class "EventLoop" as EventLoop {
+		--
+		+ EventLoop(type : string)
+		+ getEventIO() : IEventIO&
+	}
+ * "BasicEventLoop<DynamicEventIO>" <|-- EventLoop
+ * @enduml
+ */
+class EventLoop : public BasicEventLoop<DynamicEventIO>
+{
+	public:
+		explicit EventLoop(const std::string &type);
+		~EventLoop();
+
+		IEventIO	&getEventIO();
+
+	private:
+		EventLoop(const EventLoop &rhs);
+		EventLoop &operator=(const EventLoop &rhs);
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_EVENTLOOP_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
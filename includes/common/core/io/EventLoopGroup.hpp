@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   EventLoopGroup.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_EVENTLOOPGROUP_HPP
+#define COMMON_EVENTLOOPGROUP_HPP
+
+/**
+ * @file EventLoopGroup.hpp
+ * @brief Set of event loops, each run by its own pinned thread.
+ */
+
+#include <common/core/io/EventLoop.hpp>
+#include <cstddef>
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class EventLoopGroup
+ * @brief Multi-reactor runtime: one EventLoop and one thread per core.
+ *
+ * Each loop owns its own IEventIO, so loops share no state and scale
+ * with the number of cores. With pinning enabled, the thread of loop i
+ * is bound to the i-th CPU the process is allowed to run on (Linux only,
+ * ignored elsewhere).
+ *
+ * Descriptors, timers and listeners are registered on a loop before
+ * start(), or from its own thread afterwards; other threads hand work
+ * over with EventLoop::post(). The loops are driven by the group and
+ * stopped with stop(), not with EventLoop::stop().
+ *
+ * Usage:
+ * @code
+ * EventLoopGroup group("epoll");
+ * ShardedTcpServer server(group, addr, addrlen, &acceptor);
+ * group.start();
+ * @endcode
+ *
+ * @startuml
+ * class "EventLoopGroup" as EventLoopGroup {
+		- _workers : vector<Worker*>
+		- _next : size_t
+		- _pin : bool
+		- _running : bool
+		--
+		- {static} threadMain(arg : void*) : void*
+		- {static} cpuFor(index : size_t) : int
+		+ EventLoopGroup(type : string, count : size_t, pin : bool)
+		+ start() : void
+		+ stop() : void
+		+ isRunning() : bool
+		+ size() : size_t
+		+ getLoop(index : size_t) : EventLoop&
+		+ getCpu(index : size_t) : int
+		+ next() : EventLoop&
+		+ {static} cpuCount() : size_t
+	}
+ * @enduml
+ */
+class EventLoopGroup
+{
+	public:
+		EventLoopGroup(const std::string &type, std::size_t count = 0, bool pin = true);
+		~EventLoopGroup();
+
+		void			start();
+		void			stop();
+		bool			isRunning() const;
+
+		std::size_t		size() const;
+		EventLoop		&getLoop(std::size_t index);
+		int				getCpu(std::size_t index) const;
+		EventLoop		&next();
+
+		static std::size_t	cpuCount();
+
+	private:
+		/**
+		 * @struct Worker
+		 * @brief Loop, thread and CPU of one member of the group.
+		 *
+		 * @startuml
+		 * struct "Worker" as Worker {
+				group : EventLoopGroup*
+				loop : EventLoop
+				thread : pthread_t
+				cpu : int
+				started : bool
+				--
+				Worker(group : EventLoopGroup*, type : string, cpu : int)
+			}
+		 * @enduml
+		 */
+		struct Worker
+		{
+			EventLoopGroup	*group;
+			EventLoop		loop;
+			pthread_t		thread;
+			int				cpu;
+			bool			started;
+
+			Worker(EventLoopGroup *owner, const std::string &type, int init_cpu);
+		};
+
+		EventLoopGroup(const EventLoopGroup &rhs);
+		EventLoopGroup &operator=(const EventLoopGroup &rhs);
+
+		static void		*threadMain(void *arg);
+		static int		cpuFor(std::size_t index);
+
+		std::vector<Worker *>	_workers;
+		std::size_t				_next;
+		bool					_pin;
+		bool					_running;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_EVENTLOOPGROUP_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,314 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   FdTable.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_FDTABLE_HPP
+#define COMMON_FDTABLE_HPP
+
+/**
+ * @file FdTable.hpp
+ * @brief Growable table indexed by file descriptor.
+ */
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <sys/resource.h>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class FdTable
+ * @brief Flat associative table keyed by file descriptor.
+ *
+ * File descriptors are small dense integers, so entries are stored in a
+ * vector indexed by the descriptor itself: lookups are a bounds check and
+ * an index, and inserting or erasing never allocates once the table has
+ * grown. The table doubles on demand and its growth is capped at the
+ * process RLIMIT_NOFILE soft limit.
+ *
+ * @tparam T Type of the value stored per descriptor. Must be copyable and
+ *           default constructible.
+ *
+ * @startuml
+ * class "FdTable<T>" as FdTableT <<template>> {
+		- _slots : vector<Slot>
+		- _size : size_t
+		--
+		+ FdTable()
+		+ find(fd : int) : T*
+		+ contains(fd : int) : bool
+		+ insert(fd : int, value : T) : T&
+		+ erase(fd : int) : bool
+		+ clear() : void
+		+ size() : size_t
+		+ empty() : bool
+		+ {static} limit() : size_t
+		- grow(fd : int) : void
+	}
+ * @enduml
+ */
+template<typename T>
+class FdTable
+{
+	public:
+		FdTable();
+		~FdTable();
+
+		T					*find(int fd);
+		const T				*find(int fd) const;
+		bool				contains(int fd) const;
+		T					&insert(int fd, const T &value);
+		bool				erase(int fd);
+		void				clear();
+
+		std::size_t			size() const;
+		bool				empty() const;
+
+		static std::size_t	limit();
+
+	private:
+		/**
+		 * @struct Slot
+		 * @brief Value and occupancy flag stored at a descriptor index.
+		 */
+		struct Slot
+		{
+			T		value;
+			bool	used;
+
+			Slot() : value(), used(false) {}
+		};
+
+		/// Initial number of slots allocated on first insertion.
+		static const std::size_t	MIN_SLOTS = 64;
+
+		void	grow(int fd);
+
+		std::vector<Slot>	_slots;
+		std::size_t			_size;
+};
+
+template<typename T>
+const std::size_t	FdTable<T>::MIN_SLOTS;
+
+/**
+ * @brief Default constructor. Creates an empty table without allocating.
+ *
+ * @tparam T Type of the value stored per descriptor.
+ */
+template<typename T>
+FdTable<T>::FdTable() : _slots(), _size(0) {}
+
+/**
+ * @brief Destructor.
+ *
+ * @tparam T Type of the value stored per descriptor.
+ */
+template<typename T>
+FdTable<T>::~FdTable() {}
+
+/**
+ * @brief Finds the value stored for a descriptor.
+ *
+ * @tparam T Type of the value stored per descriptor.
+ * @param fd File descriptor.
+ * @return Pointer to the value, or NULL if the descriptor is absent.
+ */
+template<typename T>
+T	*FdTable<T>::find(int fd)
+{
+	if (fd < 0 || static_cast<std::size_t>(fd) >= _slots.size() || !_slots[fd].used)
+		return (NULL);
+	return (&_slots[fd].value);
+}
+
+/**
+ * @brief Finds the value stored for a descriptor.
+ *
+ * @tparam T Type of the value stored per descriptor.
+ * @param fd File descriptor.
+ * @return Pointer to the value, or NULL if the descriptor is absent.
+ */
+template<typename T>
+const T	*FdTable<T>::find(int fd) const
+{
+	if (fd < 0 || static_cast<std::size_t>(fd) >= _slots.size() || !_slots[fd].used)
+		return (NULL);
+	return (&_slots[fd].value);
+}
+
+/**
+ * @brief Tells whether a descriptor has a value.
+ *
+ * @tparam T Type of the value stored per descriptor.
+ * @param fd File descriptor.
+ * @return true if the descriptor is present.
+ */
+template<typename T>
+bool	FdTable<T>::contains(int fd) const
+{
+	return (find(fd) != NULL);
+}
+
+/**
+ * @brief Stores a value for a descriptor, replacing any previous one.
+ *
+ * @tparam T Type of the value stored per descriptor.
+ * @param fd File descriptor.
+ * @param value Value to store.
+ * @return Reference to the stored value.
+ * @throw std::out_of_range If fd is negative.
+ */
+template<typename T>
+T	&FdTable<T>::insert(int fd, const T &value)
+{
+	if (fd < 0)
+		throw std::out_of_range("FdTable: negative file descriptor");
+	if (static_cast<std::size_t>(fd) >= _slots.size())
+		grow(fd);
+	Slot &slot = _slots[fd];
+	if (!slot.used)
+		++_size;
+	slot.value = value;
+	slot.used = true;
+	return (slot.value);
+}
+
+/**
+ * @brief Removes the value of a descriptor.
+ *
+ * @tparam T Type of the value stored per descriptor.
+ * @param fd File descriptor.
+ * @return true if a value was removed.
+ */
+template<typename T>
+bool	FdTable<T>::erase(int fd)
+{
+	if (fd < 0 || static_cast<std::size_t>(fd) >= _slots.size() || !_slots[fd].used)
+		return (false);
+	_slots[fd] = Slot();
+	--_size;
+	return (true);
+}
+
+/**
+ * @brief Removes every value. The storage is kept for reuse.
+ *
+ * @tparam T Type of the value stored per descriptor.
+ */
+template<typename T>
+void	FdTable<T>::clear()
+{
+	_slots.assign(_slots.size(), Slot());
+	_size = 0;
+}
+
+/**
+ * @brief Gets the number of descriptors present.
+ *
+ * @tparam T Type of the value stored per descriptor.
+ * @return Number of values stored.
+ */
+template<typename T>
+std::size_t	FdTable<T>::size() const
+{
+	return (_size);
+}
+
+/**
+ * @brief Tells whether the table holds no value.
+ *
+ * @tparam T Type of the value stored per descriptor.
+ * @return true if empty.
+ */
+template<typename T>
+bool	FdTable<T>::empty() const
+{
+	return (_size == 0);
+}
+
+/**
+ * @brief Gets the process limit on open descriptors.
+ *
+ * @tparam T Type of the value stored per descriptor.
+ * @return RLIMIT_NOFILE soft limit, or 0 if it is unknown or unlimited.
+ */
+template<typename T>
+std::size_t	FdTable<T>::limit()
+{
+	struct rlimit rl;
+
+	if (::getrlimit(RLIMIT_NOFILE, &rl) == -1 || rl.rlim_cur == RLIM_INFINITY)
+		return (0);
+	return (static_cast<std::size_t>(rl.rlim_cur));
+}
+
+/**
+ * @brief Grows the slot vector so that @p fd becomes a valid index.
+ *
+ * The size doubles, without going past RLIMIT_NOFILE unless @p fd itself
+ * is beyond it (the limit may have been lowered after the fd was opened).
+ *
+ * @tparam T Type of the value stored per descriptor.
+ * @param fd File descriptor that must fit.
+ */
+template<typename T>
+void	FdTable<T>::grow(int fd)
+{
+	std::size_t need = static_cast<std::size_t>(fd) + 1;
+	std::size_t size = _slots.empty() ? MIN_SLOTS : _slots.size() * 2;
+	std::size_t max = limit();
+
+	if (max && size > max)
+		size = max;
+	if (size < need)
+		size = need;
+	_slots.resize(size);
+}
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_FDTABLE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IEventHandler.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_IEVENTHANDLER_HPP
+#define COMMON_IEVENTHANDLER_HPP
+
+/**
+ * @file IEventHandler.hpp
+ * @brief Interface for objects receiving events from an EventLoop.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class IEventHandler
+ * @brief Callbacks invoked by an EventLoop for a registered descriptor.
+ *
+ * A handler may remove or close its own descriptor from any callback; the
+ * loop then skips the remaining callbacks for that event.
+ *
+ * @startuml
+ * interface "IEventHandler" as IEventHandler {
+		+ onRead(fd : int) : void
+		+ onWrite(fd : int) : void
+		+ onError(fd : int) : void
+	}
+ * @enduml
+ */
+class IEventHandler
+{
+	public:
+		virtual ~IEventHandler() {};
+
+		virtual void	onRead(int fd) = 0;
+		virtual void	onWrite(int fd) = 0;
+		virtual void	onError(int fd) = 0;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_IEVENTHANDLER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
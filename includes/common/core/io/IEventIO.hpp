@@ -18,6 +18,9 @@
  * @brief Interface for multiplexed I/O event management.
  */
 
+#include <cstddef>
+#include <vector>
+
 namespace common
 {
 namespace core
@@ -33,14 +36,36 @@ namespace io
  * and waiting for events (read, write, exception) using different multiplexing
  * mechanisms (select, poll, epoll, etc.).
  *
+ * After wait(), getReady() lists only the descriptors that fired, so the
+ * caller iterates the ready set instead of probing every descriptor it
+ * owns with getEvents(). The list storage is reused from one wait() to the
+ * next and stays valid until the following wait() or clear().
+ *
+ * Each descriptor can carry an opaque user pointer, given to add() and
+ * replaced by update(), that comes back in its ReadyEvent (like epoll_data),
+ * so dispatching needs no fd -> context lookup on the caller side.
+ *
+ * Backends may queue add(), update() and remove() in a changelist, like
+ * kqueue, and apply them in one pass when wait() or flush() is called.
+ * A change the kernel rejects is then reported by the next wait() as an
+ * E_EXCEPT ready event for the descriptor, which is no longer monitored.
+ *
+ * getSyscalls() counts the system calls made by wait() and flush(), to
+ * compare backends and spot changelists that do not coalesce. The owner
+ * thread updates it with relaxed stores, any thread may read it.
+ *
  * @startuml
  * interface "IEventIO" as IEventIO {
 		+ wait(timeout_ms : int) : int
-		+ add(fd : int, mask : e_Event) : void
+		+ add(fd : int, mask : e_Event, data : void*) : void
 		+ remove(fd : int) : void
 		+ update(fd : int, mask : e_Event) : void
+		+ update(fd : int, mask : e_Event, data : void*) : void
+		+ flush() : void
 		+ clear() : void
 		+ getEvents(fd : int) : e_Event
+		+ getReady() : ReadyList
+		+ getSyscalls() : unsigned long
 	}
  * @enduml
  */
@@ -54,12 +79,30 @@ class IEventIO
 	 * These flags can be combined with binary OR operator to
 	 * monitor multiple event types simultaneously.
 	 *
+	 * E_EDGE and E_ONESHOT are modifiers: they change how the directions
+	 * (E_IN, E_OUT, E_EXCEPT) are reported and are never returned by
+	 * getEvents(). Backends with native support (epoll) map them to
+	 * EPOLLET and EPOLLONESHOT. Others emulate them by disarming after a
+	 * report: E_ONESHOT disarms the whole descriptor and E_EDGE disarms the
+	 * reported directions. In both cases update() re-arms the descriptor,
+	 * which portable code does once it has drained it (EAGAIN).
+	 *
+	 * E_EXCLUSIVE is a modifier for a descriptor monitored by several
+	 * instances at once, typically a listening socket inherited by worker
+	 * processes: an event wakes one of the waiters instead of all of them.
+	 * Only epoll honours it, as EPOLLEXCLUSIVE (see
+	 * EventFactoryIO::supportsExclusive()); the other backends ignore it,
+	 * and an AcceptMutex keeps their workers from waking together.
+	 *
 	 * @startuml
 	 * enum "e_Event" as e_Event {
 			E_NONE
 			E_IN
 			E_OUT
 			E_EXCEPT
+			E_EDGE
+			E_ONESHOT
+			E_EXCLUSIVE
 		}
 	 * @enduml
 	 */
@@ -69,16 +112,100 @@ class IEventIO
 		E_IN = 1 << 0,      ///< Data available for reading
 		E_OUT = 1 << 1,     ///< Ready for writing
 		E_EXCEPT = 1 << 2,  ///< Exceptional condition
+		E_EDGE = 1 << 3,    ///< Report state changes only (modifier)
+		E_ONESHOT = 1 << 4, ///< Disarm after the first report (modifier)
+		E_EXCLUSIVE = 1 << 5, ///< Wake one of the waiters sharing the descriptor (modifier)
+	};
+
+	/**
+	 * @struct ReadyEvent
+	 * @brief Descriptor reported ready by the last wait().
+	 *
+	 * @startuml
+	 * struct "ReadyEvent" as ReadyEvent {
+			fd : int
+			events : e_Event
+			data : void*
+		}
+	 * @enduml
+	 */
+	struct ReadyEvent
+	{
+		int		fd;     ///< Ready file descriptor
+		e_Event	events; ///< Reported directions, E_NONE if removed since
+		void	*data;  ///< User pointer registered with the descriptor
 	};
+
+	/// Contiguous list of the descriptors reported by the last wait().
+	typedef std::vector<ReadyEvent>	ReadyList;
+
 		virtual ~IEventIO() {};
 
 		virtual int	wait(int timeout_ms) = 0;
-		virtual void add(int fd, e_Event mask) = 0;
+		virtual void add(int fd, e_Event mask, void *data = NULL) = 0;
 		virtual void remove(int fd) = 0;
 		virtual void update(int fd, e_Event mask) = 0;
+		virtual void update(int fd, e_Event mask, void *data) = 0;
+		virtual void flush() = 0;
 		virtual void clear() = 0;
 
 		virtual e_Event getEvents(int fd) const = 0;
+		virtual const ReadyList &getReady() const = 0;
+		virtual unsigned long getSyscalls() const = 0;
+
+	protected:
+		/**
+		 * @struct Interest
+		 * @brief Registration of a monitored descriptor, kept by the backends.
+		 */
+		struct Interest
+		{
+			e_Event	events; ///< Registered event mask, modifiers included
+			void	*data;  ///< User pointer returned with each ReadyEvent
+
+			Interest() : events(E_NONE), data(NULL) {}
+			Interest(e_Event init_events, void *init_data) : events(init_events), data(init_data) {}
+		};
+
+		/**
+		 * @brief Counts one system call in a counter read by other threads.
+		 *
+		 * @param counter Syscall counter of the backend, written by its owner only.
+		 */
+		static void		countSyscall(unsigned long &counter)
+		{
+			__atomic_store_n(&counter, counter + 1, __ATOMIC_RELAXED);
+		}
+
+		/**
+		 * @brief Computes the interest left after a report, for emulated modifiers.
+		 *
+		 * @param interest Registered event mask, modifiers included.
+		 * @param reported Directions reported for the descriptor.
+		 * @return Interest mask to keep monitoring with.
+		 */
+		static e_Event	disarm(e_Event interest, e_Event reported)
+		{
+			if (interest & E_ONESHOT)
+				return (static_cast<e_Event>(interest & ~(E_IN | E_OUT | E_EXCEPT)));
+			if (interest & E_EDGE)
+				return (static_cast<e_Event>(interest & ~reported));
+			return (interest);
+		}
+
+		/**
+		 * @brief Tells whether an emulated modifier left the descriptor without directions.
+		 *
+		 * Such a descriptor is kept registered but must not be handed to the
+		 * kernel, which would otherwise keep reporting errors and hang-ups.
+		 *
+		 * @param interest Registered event mask, modifiers included.
+		 * @return true if the descriptor is disarmed.
+		 */
+		static bool		isDisarmed(e_Event interest)
+		{
+			return ((interest & (E_EDGE | E_ONESHOT)) && !(interest & (E_IN | E_OUT | E_EXCEPT)));
+		}
 };
 
 } // !io
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IIdleHandler.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_IIDLEHANDLER_HPP
+#define COMMON_IIDLEHANDLER_HPP
+
+/**
+ * @file IIdleHandler.hpp
+ * @brief Interface for objects evicted by an IdleTracker.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+class IdleEntry;
+
+/**
+ * @class IIdleHandler
+ * @brief Callback invoked by an IdleTracker when an entry has been idle
+ * for the tracker's timeout.
+ *
+ * The entry is untracked before the callback runs: the handler may close
+ * the connection and destroy the entry, or add it back to keep it.
+ *
+ * @startuml
+ * interface "IIdleHandler" as IIdleHandler {
+		+ onIdle(entry : IdleEntry&) : void
+	}
+ * @enduml
+ */
+class IIdleHandler
+{
+	public:
+		virtual ~IIdleHandler() {};
+
+		virtual void	onIdle(IdleEntry &entry) = 0;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_IIDLEHANDLER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
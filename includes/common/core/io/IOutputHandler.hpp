@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IOutputHandler.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_IOUTPUTHANDLER_HPP
+#define COMMON_IOUTPUTHANDLER_HPP
+
+/**
+ * @file IOutputHandler.hpp
+ * @brief Interface for objects told about deferred flushes that could not
+ * complete.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+class OutputQueue;
+
+/**
+ * @class IOutputHandler
+ * @brief Callbacks invoked by an event loop when the deferred flush of an
+ * OutputQueue stops short.
+ *
+ * onBlocked() means the socket buffer is full: the remaining data stays
+ * queued and the queue is no longer deferred by appends. The handler
+ * typically enables E_OUT on the descriptor and calls OutputQueue::flush()
+ * from onWrite(), until it returns true. onError() means the write
+ * failed: the queue has been cleared and the connection is usually
+ * closed. Both run on the loop thread, after the iteration's tasks.
+ *
+ * @startuml
+ * interface "IOutputHandler" as IOutputHandler {
+		+ onBlocked(queue : OutputQueue&) : void
+		+ onError(queue : OutputQueue&, error : int) : void
+	}
+ * @enduml
+ */
+class IOutputHandler
+{
+	public:
+		virtual ~IOutputHandler() {};
+
+		virtual void	onBlocked(OutputQueue &queue) = 0;
+		virtual void	onError(OutputQueue &queue, int error) = 0;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_IOUTPUTHANDLER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,200 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IdleTracker.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_IDLETRACKER_HPP
+#define COMMON_IDLETRACKER_HPP
+
+/**
+ * @file IdleTracker.hpp
+ * @brief Idle-timeout manager keeping entries in least-recently-active order.
+ */
+
+#include <common/core/io/IIdleHandler.hpp>
+#include <common/core/io/ITimerHandler.hpp>
+#include <common/core/io/TimerWheel.hpp>
+#include <cstddef>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+class IdleTracker;
+
+/**
+ * @class IdleEntry
+ * @brief Intrusive node tracked by an IdleTracker.
+ *
+ * The entry is owned by the caller, typically embedded in a connection
+ * object next to its handler, and carries the links of the tracker's
+ * list: tracking, touching and untracking never allocate. A tracked entry
+ * is untracked by its destructor.
+ *
+ * @startuml
+ * class "IdleEntry" as IdleEntry {
+		- _handler : IIdleHandler*
+		- _tracker : IdleTracker*
+		- _prev : IdleEntry*
+		- _next : IdleEntry*
+		- _lastActive : unsigned long
+		--
+		+ IdleEntry(handler : IIdleHandler*)
+		+ setHandler(handler : IIdleHandler*) : void
+		+ getHandler() : IIdleHandler*
+		+ isTracked() : bool
+		+ getLastActive() : unsigned long
+	}
+ * @enduml
+ */
+class IdleEntry
+{
+	public:
+		explicit IdleEntry(IIdleHandler *handler = NULL);
+		~IdleEntry();
+
+		void			setHandler(IIdleHandler *handler);
+		IIdleHandler	*getHandler() const;
+		bool			isTracked() const;
+		unsigned long	getLastActive() const;
+
+	private:
+		friend class IdleTracker;
+
+		IdleEntry(const IdleEntry &rhs);
+		IdleEntry &operator=(const IdleEntry &rhs);
+
+		IIdleHandler	*_handler;
+		IdleTracker		*_tracker;
+		IdleEntry		*_prev;
+		IdleEntry		*_next;
+		unsigned long	_lastActive;
+};
+
+/**
+ * @class IdleTracker
+ * @brief Closes idle connections with one list and one timer.
+ *
+ * Entries sit on a doubly linked list ordered by last activity, the most
+ * recent at the head. touch() stamps an entry with the wheel's current
+ * time and moves it to the head: an unlink and a relink, whatever the
+ * number of entries. The tail is thus always the entry closest to its
+ * deadline, and a single Timer, scheduled on the TimerWheel for that
+ * deadline, drives the evictions.
+ *
+ * The timer is not moved when the tail is touched. When it fires, every
+ * tail entry idle for the timeout is unlinked and handed to its
+ * IIdleHandler, then the timer is scheduled again for the new tail. A
+ * busy connection therefore costs two pointer swaps per touch and no
+ * wheel operation.
+ *
+ * Time is the wheel's getTime(), the loop time of the last iteration, so
+ * touch() reads no clock. The tracker is single-threaded, like the wheel.
+ *
+ * Usage:
+ * @code
+ * IdleTracker idle(loop.getTimers(), 30000);
+ * idle.add(conn.idleEntry);   // on accept
+ * idle.touch(conn.idleEntry); // on each read or write
+ * @endcode
+ *
+ * @startuml
+ * class "IdleTracker" as IdleTracker {
+		- _timers : TimerWheel&
+		- _timer : Timer
+		- _head : IdleEntry*
+		- _tail : IdleEntry*
+		- _timeout : unsigned long
+		- _size : size_t
+		--
+		- link(entry : IdleEntry&) : void
+		- unlink(entry : IdleEntry&) : void
+		- arm() : void
+		+ IdleTracker(timers : TimerWheel&, timeout_ms : unsigned long)
+		+ add(entry : IdleEntry&) : void
+		+ touch(entry : IdleEntry&) : void
+		+ remove(entry : IdleEntry&) : void
+		+ onTimeout(timer : Timer&) : void
+		+ setTimeout(timeout_ms : unsigned long) : void
+		+ getTimeout() : unsigned long
+		+ size() : size_t
+		+ empty() : bool
+		+ clear() : void
+	}
+ * @enduml
+ */
+class IdleTracker : public ITimerHandler
+{
+	public:
+		IdleTracker(TimerWheel &timers, unsigned long timeout_ms);
+		~IdleTracker();
+
+		void			add(IdleEntry &entry);
+		void			touch(IdleEntry &entry);
+		void			remove(IdleEntry &entry);
+		void			onTimeout(Timer &timer);
+
+		void			setTimeout(unsigned long timeout_ms);
+		unsigned long	getTimeout() const;
+		std::size_t		size() const;
+		bool			empty() const;
+		void			clear();
+
+	private:
+		IdleTracker(const IdleTracker &rhs);
+		IdleTracker &operator=(const IdleTracker &rhs);
+
+		void			link(IdleEntry &entry);
+		void			unlink(IdleEntry &entry);
+		void			arm();
+
+		TimerWheel		&_timers;
+		Timer			_timer;
+		IdleEntry		*_head;
+		IdleEntry		*_tail;
+		unsigned long	_timeout;
+		std::size_t		_size;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_IDLETRACKER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
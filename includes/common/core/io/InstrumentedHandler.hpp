@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   InstrumentedHandler.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_INSTRUMENTEDHANDLER_HPP
+#define COMMON_INSTRUMENTEDHANDLER_HPP
+
+/**
+ * @file InstrumentedHandler.hpp
+ * @brief IEventHandler decorator timing the callbacks of another handler.
+ */
+
+#include <common/core/io/IEventHandler.hpp>
+#include <common/core/utils/Histogram.hpp>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class InstrumentedHandler
+ * @brief Records the latency of each callback of a wrapped handler.
+ *
+ * Registered on an EventLoop in place of the handler it wraps, it
+ * forwards every callback and records its duration in nanoseconds, so
+ * that each handler gets its own latency histogram. Only the wrapped
+ * handlers pay for the two clock reads per callback.
+ *
+ * @note The decorator must outlive the callbacks it forwards: a handler
+ *       that destroys itself must not destroy its decorator from within.
+ *
+ * Usage:
+ * @code
+ * InstrumentedHandler timed(connection);
+ * loop.add(fd, IEventIO::E_IN, &timed);
+ * unsigned long p99 = timed.getLatency().percentile(99);
+ * @endcode
+ *
+ * @startuml
+ * class "InstrumentedHandler" as InstrumentedHandler {
+		- _handler : IEventHandler&
+		- _latency : Histogram
+		--
+		+ InstrumentedHandler(handler : IEventHandler&)
+		+ onRead(fd : int) : void
+		+ onWrite(fd : int) : void
+		+ onError(fd : int) : void
+		+ getLatency() : Histogram::Snapshot
+	}
+ * @enduml
+ */
+class InstrumentedHandler : public IEventHandler
+{
+	public:
+		explicit InstrumentedHandler(IEventHandler &handler);
+		~InstrumentedHandler();
+
+		void	onRead(int fd);
+		void	onWrite(int fd);
+		void	onError(int fd);
+
+		utils::Histogram::Snapshot	getLatency() const;
+
+	private:
+		InstrumentedHandler(const InstrumentedHandler &rhs);
+		InstrumentedHandler &operator=(const InstrumentedHandler &rhs);
+
+		IEventHandler		&_handler;
+		utils::Histogram	_latency;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_INSTRUMENTEDHANDLER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
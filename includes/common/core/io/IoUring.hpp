@@ -0,0 +1,209 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IoUring.hpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_IOURING_HPP
+#define COMMON_IOURING_HPP
+
+/**
+ * @file IoUring.hpp
+ * @brief Minimal io_uring(7) ring on raw system calls (Linux only).
+ */
+
+#if defined(__linux__) && defined(__has_include)
+# if __has_include(<linux/io_uring.h>)
+#  include <linux/io_uring.h>
+#  include <sys/syscall.h>
+#  if defined(IORING_ENTER_EXT_ARG) && defined(IORING_FEAT_RSRC_TAGS) && defined(__NR_io_uring_setup)
+/// Defined when the kernel headers provide everything IoUring relies on.
+#   define COMMON_HAS_IO_URING 1
+#  endif
+# endif
+#endif
+
+#if defined(COMMON_HAS_IO_URING)
+
+#include <cstddef>
+#include <common/core/raii/UniqueFd.hpp>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class IoUring
+ * @brief Submission and completion rings shared with the kernel.
+ *
+ * Wraps io_uring_setup(2) and io_uring_enter(2) without liburing. SQEs
+ * obtained from getSqe() are only made visible to the kernel by submit()
+ * or submitAndWait(), so any number of requests costs one system call.
+ * Completions are read straight from the shared memory with peekCqe()
+ * and released in bulk with advanceCq().
+ *
+ * With IORING_SETUP_SQPOLL, a kernel thread consumes the submission ring
+ * on its own and submit() only makes a system call to wake it up once it
+ * went idle.
+ *
+ * The kernel must map both rings in one area (IORING_FEAT_SINGLE_MMAP,
+ * Linux 5.4); the constructor throws otherwise, as it does when io_uring
+ * is missing or disabled, so that callers can fall back to another API.
+ *
+ * @note Not thread-safe: a ring belongs to the thread that drives it.
+ *
+ * @startuml
+ * class "IoUring" as IoUring {
+		- _fd : UniqueFd
+		- _ring : void*
+		- _ringSize : size_t
+		- _sqes : io_uring_sqe*
+		- _sqesSize : size_t
+		- _features : unsigned
+		- _flags : unsigned
+		- _sqHead : unsigned*
+		- _sqTail : unsigned*
+		- _sqFlags : unsigned*
+		- _sqArray : unsigned*
+		- _sqMask : unsigned
+		- _sqEntries : unsigned
+		- _sqLocalTail : unsigned
+		- _cqHead : unsigned*
+		- _cqTail : unsigned*
+		- _cqes : io_uring_cqe*
+		- _cqMask : unsigned
+		- _syscalls : unsigned long
+		--
+		+ IoUring(entries : unsigned, flags : unsigned, sq_idle_ms : unsigned)
+		+ getSqe() : io_uring_sqe*
+		+ submit() : unsigned
+		+ submitAndWait(wait_nr : unsigned, timeout_ms : int) : unsigned
+		+ peekCqe() : io_uring_cqe*
+		+ advanceCq(count : unsigned) : void
+		+ registerResource(opcode : unsigned, arg : const void*, nr : unsigned) : void
+		+ pending() : unsigned
+		+ getFd() : int
+		+ getFeatures() : unsigned
+		+ getEntries() : unsigned
+		+ getSyscalls() : unsigned long
+		- enter(to_submit : unsigned, wait_nr : unsigned, timeout_ms : int, flags : unsigned) : unsigned
+		- unmap() : void
+	}
+ * @enduml
+ */
+class IoUring
+{
+	public:
+		explicit IoUring(unsigned entries = DEFAULT_ENTRIES, unsigned flags = 0, unsigned sq_idle_ms = 0);
+		~IoUring();
+
+		struct io_uring_sqe	*getSqe();
+		unsigned			submit();
+		unsigned			submitAndWait(unsigned wait_nr, int timeout_ms);
+
+		/**
+		 * @brief Gets the oldest completion not yet released.
+		 *
+		 * @return Completion entry, or NULL if the completion ring is empty.
+		 */
+		struct io_uring_cqe	*peekCqe()
+		{
+			unsigned head = *_cqHead;
+
+			if (head == __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE))
+				return (NULL);
+			return (&_cqes[head & _cqMask]);
+		}
+
+		/**
+		 * @brief Releases completions to the kernel once they have been read.
+		 *
+		 * @param count Number of completions consumed since the last call.
+		 */
+		void				advanceCq(unsigned count = 1)
+		{
+			__atomic_store_n(_cqHead, *_cqHead + count, __ATOMIC_RELEASE);
+		}
+
+		void				registerResource(unsigned opcode, const void *arg, unsigned nr);
+
+		unsigned			pending() const;
+		int					getFd() const;
+		unsigned			getFeatures() const;
+		unsigned			getEntries() const;
+		unsigned long		getSyscalls() const;
+
+		/// Submission ring size used when none is given.
+		static const unsigned	DEFAULT_ENTRIES = 256;
+
+	private:
+		IoUring(const IoUring &rhs);
+		IoUring &operator=(const IoUring &rhs);
+
+		unsigned			enter(unsigned to_submit, unsigned wait_nr, int timeout_ms, unsigned flags);
+		void				unmap();
+
+		common::core::raii::UniqueFd	_fd;
+		void							*_ring;
+		std::size_t						_ringSize;
+		struct io_uring_sqe				*_sqes;
+		std::size_t						_sqesSize;
+		unsigned						_features;
+		unsigned						_flags;
+		unsigned						*_sqHead;
+		unsigned						*_sqTail;
+		unsigned						*_sqFlags;
+		unsigned						*_sqArray;
+		unsigned						_sqMask;
+		unsigned						_sqEntries;
+		unsigned						_sqLocalTail;
+		unsigned						*_cqHead;
+		unsigned						*_cqTail;
+		struct io_uring_cqe				*_cqes;
+		unsigned						_cqMask;
+		unsigned long					_syscalls;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // COMMON_HAS_IO_URING
+
+#endif // !COMMON_IOURING_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,223 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IoUringCompletionIO.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_IOURINGCOMPLETIONIO_HPP
+#define COMMON_IOURINGCOMPLETIONIO_HPP
+
+/**
+ * @file IoUringCompletionIO.hpp
+ * @brief Completion-based socket I/O on io_uring(7) (Linux only).
+ */
+
+#include <common/core/io/IoUring.hpp>
+
+#if defined(COMMON_HAS_IO_URING)
+
+#include <cstddef>
+#include <vector>
+#include <sys/uio.h>
+#include <common/core/io/FdTable.hpp>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class IoUringCompletionIO
+ * @brief Asynchronous accept, recv, send, readv, writev and close.
+ *
+ * Where IEventIO reports that a descriptor is ready and leaves the
+ * system call to the caller, this engine submits the operation itself as
+ * an SQE and reports its result. A connection therefore costs no system
+ * call per request: operations queued between two wait() calls are
+ * submitted together by the next one, which also reaps their results.
+ * With @p sqpoll a kernel thread even picks the SQEs up on its own.
+ *
+ * Every operation carries an opaque token, handed back unchanged in its
+ * Completion with the result the system call would have returned
+ * (negative errno on failure). Buffers and iovec arrays belong to the
+ * caller and must stay valid until the completion is reaped.
+ *
+ * Descriptors given to registerFd() are used through the ring's
+ * registered file table (IOSQE_FIXED_FILE), saving the per-operation
+ * file lookup and reference counting; buffers given to registerBuffers()
+ * are pinned once and used by readFixed() and writeFixed().
+ *
+ * Any TcpServer or TcpClient descriptor can be switched to completion
+ * mode: remove it from its EventLoop, then queue operations on getFd().
+ * Accepted descriptors are non-blocking and close-on-exec and can be
+ * wrapped in a TcpClient. The ring descriptor itself becomes readable
+ * when completions are pending, so an EventLoop can drive the engine by
+ * calling wait(0) from the handler registered for getFd().
+ *
+ * Usage:
+ * @code
+ * IoUringCompletionIO engine;
+ * engine.accept(server.getFd(), &listener, true);
+ * for (;;)
+ * {
+ *     engine.wait(-1);
+ *     for (IoUringCompletionIO::CompletionList::const_iterator it = engine.getCompleted().begin();
+ *          it != engine.getCompleted().end(); ++it)
+ *         static_cast<Connection *>(it->token)->onComplete(engine, *it);
+ * }
+ * @endcode
+ *
+ * @note Not thread-safe, like the IoUring it owns.
+ *
+ * @startuml
+ * class "IoUringCompletionIO" as IoUringCompletionIO {
+		- _ring : IoUring
+		- _completed : CompletionList
+		- _buffers : vector<iovec>
+		- _slots : FdTable<unsigned>
+		- _freeSlots : vector<unsigned>
+		- _closingSlots : vector<unsigned>
+		- _inflight : size_t
+		--
+		- prepare(opcode : int, fd : int, token : void*) : io_uring_sqe*
+		- updateSlot(slot : unsigned, fd : int) : void
+		- submitted() : void
+		- processResults() : void
+		+ IoUringCompletionIO(entries : unsigned, sqpoll : bool)
+		+ accept(fd : int, token : void*, multishot : bool) : void
+		+ recv(fd : int, buf : void*, len : size_t, token : void*) : void
+		+ send(fd : int, buf : const void*, len : size_t, token : void*) : void
+		+ readv(fd : int, iov : const iovec*, iovcnt : int, token : void*) : void
+		+ writev(fd : int, iov : const iovec*, iovcnt : int, token : void*) : void
+		+ readFixed(fd : int, buf_index : unsigned, offset : size_t, len : size_t, token : void*) : void
+		+ writeFixed(fd : int, buf_index : unsigned, offset : size_t, len : size_t, token : void*) : void
+		+ close(fd : int, token : void*) : void
+		+ registerBuffers(iov : const iovec*, count : unsigned) : void
+		+ registerFiles(slots : unsigned) : void
+		+ registerFd(fd : int) : void
+		+ unregisterFd(fd : int) : void
+		+ submit() : void
+		+ wait(timeout_ms : int) : int
+		+ getCompleted() : CompletionList
+		+ getInflight() : size_t
+		+ getFd() : int
+		+ getSyscalls() : unsigned long
+	}
+ * @enduml
+ */
+class IoUringCompletionIO
+{
+	public:
+		/**
+		 * @struct Completion
+		 * @brief Result of an operation reaped by the last wait().
+		 *
+		 * @startuml
+		 * struct "Completion" as Completion {
+				token : void*
+				result : int
+				more : bool
+			}
+		 * @enduml
+		 */
+		struct Completion
+		{
+			void	*token;  ///< Token given with the operation
+			int		result;  ///< System call result, or -errno
+			bool	more;    ///< A multishot operation stays armed
+		};
+
+		/// Contiguous list of the completions reaped by the last wait().
+		typedef std::vector<Completion>	CompletionList;
+
+		explicit IoUringCompletionIO(unsigned entries = IoUring::DEFAULT_ENTRIES, bool sqpoll = false);
+		~IoUringCompletionIO();
+
+		void	accept(int fd, void *token, bool multishot = false);
+		void	recv(int fd, void *buf, std::size_t len, void *token);
+		void	send(int fd, const void *buf, std::size_t len, void *token);
+		void	readv(int fd, const struct iovec *iov, int iovcnt, void *token);
+		void	writev(int fd, const struct iovec *iov, int iovcnt, void *token);
+		void	readFixed(int fd, unsigned buf_index, std::size_t offset, std::size_t len, void *token);
+		void	writeFixed(int fd, unsigned buf_index, std::size_t offset, std::size_t len, void *token);
+		void	close(int fd, void *token);
+
+		void	registerBuffers(const struct iovec *iov, unsigned count);
+		void	registerFiles(unsigned slots);
+		void	registerFd(int fd);
+		void	unregisterFd(int fd);
+
+		void	submit();
+		int		wait(int timeout_ms);
+
+		const CompletionList	&getCompleted() const;
+		std::size_t				getInflight() const;
+		int						getFd() const;
+		unsigned long			getSyscalls() const;
+
+	private:
+		IoUringCompletionIO(const IoUringCompletionIO &rhs);
+		IoUringCompletionIO &operator=(const IoUringCompletionIO &rhs);
+
+		/// Idle time after which the IORING_SETUP_SQPOLL thread sleeps.
+		static const unsigned	SQPOLL_IDLE_MS = 50;
+
+		struct io_uring_sqe	*prepare(int opcode, int fd, void *token);
+		void				updateSlot(unsigned slot, int fd);
+		void				submitted();
+		void				processResults();
+
+		IoUring					_ring;
+		CompletionList			_completed;
+		std::vector<struct iovec>	_buffers;
+		FdTable<unsigned>		_slots;
+		std::vector<unsigned>	_freeSlots;
+		std::vector<unsigned>	_closingSlots;
+		std::size_t				_inflight;
+
+		/// Address used as user_data by internal requests.
+		static const char		_internal;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // COMMON_HAS_IO_URING
+
+#endif // !COMMON_IOURINGCOMPLETIONIO_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,286 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IoUringEventIO.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_IOURINGEVENTIO_HPP
+#define COMMON_IOURINGEVENTIO_HPP
+
+/**
+ * @file IoUringEventIO.hpp
+ * @brief IEventIO implementation based on io_uring(7) poll requests (Linux only).
+ */
+
+#include <common/core/io/IoUring.hpp>
+
+#if defined(COMMON_HAS_IO_URING)
+
+#include <cstddef>
+#include <vector>
+#include <stdint.h>
+#include <poll.h>
+#include <common/core/io/FdTable.hpp>
+#include <common/core/io/IEventIO.hpp>
+#include <common/core/raii/UniquePtr.hpp>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class IoUringEventIO
+ * @brief I/O event handler using IORING_OP_POLL_ADD requests.
+ *
+ * Each monitored descriptor has one poll request in flight in an
+ * IoUring. Arming, re-arming and cancelling are SQEs written to the
+ * shared submission ring and readiness comes back as CQEs read from
+ * shared memory, so a whole wait() — changelist included — costs a
+ * single io_uring_enter(2), whatever the number of descriptors touched.
+ *
+ * add(), update() and remove() are queued in a changelist like in
+ * EpollEventIO and turned into SQEs by flush(). An invalid descriptor
+ * is reported by the kernel in its CQE, and then by wait() as an
+ * E_EXCEPT ready event.
+ *
+ * Multishot polls (IORING_POLL_ADD_MULTI) post a CQE per wakeup and stay
+ * armed, which is exactly E_EDGE. Level-triggered descriptors use
+ * single-shot polls re-armed by the next wait(), where the kernel checks
+ * readiness again; E_ONESHOT ones stay disarmed until update().
+ *
+ * @note A poll request holds a reference on the file: a descriptor
+ *       removed then closed is only released by the kernel when the next
+ *       wait() or flush() submits the cancellation.
+ * @note Requires Linux 5.13 (multishot poll and IORING_ENTER_EXT_ARG);
+ *       the constructor throws on older kernels.
+ *
+ * @startuml
+ * class "IoUringEventIO" as IoUringEventIO {
+		- _ring : UniquePtr<IoUring>
+		- _events : FdTable<Entry>
+		- _ready : ReadyList
+		- _changes : vector<int>
+		- _generation : uint32_t
+		- _syscalls : unsigned long
+		- _pastSyscalls : unsigned long
+		--
+		- queue(fd : int, entry : Entry&) : void
+		- prepare() : void
+		- apply(fd : int, entry : Entry&) : void
+		- arm(fd : int, entry : Entry&) : void
+		- cancel(fd : int, entry : Entry&) : void
+		- getSqe() : io_uring_sqe*
+		- processResults() : void
+		- report(fd : int, entry : Entry&, mask : e_Event) : void
+		- countSyscalls() : void
+		- {static} eventToMask(event : e_Event) : uint32_t
+		- {static} maskToEvent(mask : uint32_t) : e_Event
+		+ IoUringEventIO()
+		+ wait(timeout_ms : int) : int
+		+ add(fd : int, mask : e_Event, data : void*) : void
+		+ remove(fd : int) : void
+		+ update(fd : int, mask : e_Event) : void
+		+ update(fd : int, mask : e_Event, data : void*) : void
+		+ flush() : void
+		+ clear() : void
+		+ getEvents(fd : int) : e_Event
+		+ getReady() : ReadyList
+		+ getSyscalls() : unsigned long
+		+ {static} isSupported() : bool
+	}
+ * @enduml
+ */
+class IoUringEventIO : public IEventIO
+{
+	public:
+		IoUringEventIO();
+		~IoUringEventIO();
+
+		int		wait(int timeout_ms);
+		void	add(int fd, e_Event mask, void *data = NULL);
+		void	remove(int fd);
+		void	update(int fd, e_Event mask);
+		void	update(int fd, e_Event mask, void *data);
+		void	flush();
+		void	clear();
+
+		e_Event getEvents(int fd) const;
+		const ReadyList &getReady() const;
+		unsigned long getSyscalls() const;
+
+		static bool	isSupported();
+
+	private:
+		/**
+		 * @struct Entry
+		 * @brief Registration state of a monitored descriptor.
+		 *
+		 * @startuml
+		 * struct "Entry" as Entry {
+				events : e_Event
+				ready : e_Event
+				kernel : e_Event
+				data : void*
+				slot : size_t
+				generation : uint32_t
+				active : bool
+				inflight : bool
+				queued : bool
+				--
+				Entry()
+			}
+		 * @enduml
+		 */
+		struct Entry
+		{
+			e_Event		events;     ///< Wanted event mask, modifiers included
+			e_Event		ready;      ///< Events reported by the last wait()
+			e_Event		kernel;     ///< Mask of the poll request, disarmed once fired if oneshot
+			void		*data;      ///< User pointer returned with each ReadyEvent
+			std::size_t	slot;       ///< Index in the ready list while ready is set
+			uint32_t	generation; ///< Tag of the poll request in flight
+			bool		active;     ///< Cleared by remove() until the change is flushed
+			bool		inflight;   ///< A poll request is armed in the kernel
+			bool		queued;     ///< Listed in the changelist
+
+			Entry();
+		};
+
+		IoUringEventIO(const IoUringEventIO &rhs);
+		IoUringEventIO &operator=(const IoUringEventIO &rhs);
+
+		/// user_data of the cancellation requests, whose completions are ignored.
+		static const uint64_t	CANCEL_TAG = 0xffffffffULL;
+
+		void					queue(int fd, Entry &entry);
+		void					prepare();
+		void					apply(int fd, Entry &entry);
+		void					arm(int fd, Entry &entry);
+		void					cancel(int fd, Entry &entry);
+		struct io_uring_sqe		*getSqe();
+		void					processResults();
+		void					report(int fd, Entry &entry, e_Event mask);
+		void					countSyscalls();
+
+		static uint32_t	eventToMask(e_Event event);
+		static e_Event	maskToEvent(uint32_t mask);
+
+		common::core::raii::UniquePtr<IoUring>	_ring;
+		FdTable<Entry>							_events;
+		ReadyList								_ready;
+		std::vector<int>						_changes;
+		uint32_t								_generation;
+		unsigned long							_syscalls;
+		unsigned long							_pastSyscalls;  ///< Made by the rings replaced by clear()
+
+		/// Result of the isSupported() probe: -1 before it, 0 or 1 after.
+		static int								_supported;
+};
+
+/**
+ * @brief Gets the descriptors reported by the last wait().
+ *
+ * @return Ready list, valid until the next wait() or clear().
+ */
+inline const IEventIO::ReadyList &IoUringEventIO::getReady() const
+{
+	return (_ready);
+}
+
+/**
+ * @brief Gets the number of system calls made by wait() and flush().
+ *
+ * @return Syscall count since construction. Safe from any thread.
+ */
+inline unsigned long IoUringEventIO::getSyscalls() const
+{
+	return (__atomic_load_n(&_syscalls, __ATOMIC_RELAXED));
+}
+
+/**
+ * @brief Converts IEventIO event mask to poll(2) event mask.
+ *
+ * POLLERR and POLLHUP are always reported by the kernel, E_EXCEPT only
+ * adds POLLPRI for out-of-band data. Modifiers select the request type
+ * in arm() and have no poll(2) bit.
+ *
+ * @param event IEventIO event mask.
+ * @return Corresponding poll(2) event mask.
+ */
+inline uint32_t IoUringEventIO::eventToMask(e_Event event)
+{
+	uint32_t mask = 0;
+
+	if (event & E_IN)
+		mask |= POLLIN;
+	if (event & E_OUT)
+		mask |= POLLOUT;
+	if (event & E_EXCEPT)
+		mask |= POLLPRI;
+
+	return (mask);
+}
+
+/**
+ * @brief Converts poll(2) event mask to IEventIO event mask.
+ *
+ * @param mask poll(2) event mask.
+ * @return Corresponding IEventIO event mask.
+ */
+inline IEventIO::e_Event IoUringEventIO::maskToEvent(uint32_t mask)
+{
+	e_Event event = E_NONE;
+
+	if (mask & POLLIN)
+		event = static_cast<e_Event>(event | E_IN);
+	if (mask & POLLOUT)
+		event = static_cast<e_Event>(event | E_OUT);
+	if (mask & (POLLERR | POLLHUP | POLLPRI))
+		event = static_cast<e_Event>(event | E_EXCEPT);
+
+	return (event);
+}
+
+} // !io
+} // !core
+} // !common
+
+#endif // COMMON_HAS_IO_URING
+
+#endif // !COMMON_IOURINGEVENTIO_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,216 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   OutputQueue.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_OUTPUTQUEUE_HPP
+#define COMMON_OUTPUTQUEUE_HPP
+
+/**
+ * @file OutputQueue.hpp
+ * @brief Per-connection output queue flushed once per loop iteration.
+ */
+
+#include <common/core/io/IOutputHandler.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+class AEventLoop;
+
+/**
+ * @class OutputQueue
+ * @brief Coalesces the response fragments of a connection into one
+ * gathered write.
+ *
+ * append() copies a fragment at the end of an owned buffer, merged with
+ * the previous copied fragment when they are adjacent; appendRef() queues
+ * caller memory without copying, which must stay valid until sent. A
+ * flush hands every fragment to one sendmsg(2), the writev(2) of sockets
+ * with MSG_NOSIGNAL, and keeps what the socket did not take. Once
+ * drained, the buffers are reset but keep their capacity, so a steady
+ * connection does not allocate; a queue that never drains drops its sent
+ * prefix once it outweighs the rest.
+ *
+ * A queue attached to a loop defers itself on its first append: the loop
+ * flushes every deferred queue once, at the end of the iteration, so
+ * the fragments produced by pipelined requests in the same tick leave in
+ * one system call and as few segments as possible. An incomplete flush is
+ * reported to the IOutputHandler. A queue the socket did not drain is
+ * blocked: appends no longer defer it, so the loop does not retry a full
+ * socket every iteration, until a flush() from onWrite() drains it. With setCork(true), a flush needing
+ * more than one sendmsg(2) is bracketed by TCP_CORK (TCP_NOPUSH on the
+ * BSDs) so that the batches are not sent as partial segments.
+ *
+ * The queue is used from the loop thread only.
+ *
+ * Usage:
+ * @code
+ * OutputQueue out(client.getFd(), &connection);
+ * out.attach(loop);
+ * out.append(header, headerLength); // from onRead()
+ * out.appendRef(body, bodyLength);
+ * @endcode
+ *
+ * @startuml
+ * class "OutputQueue" as OutputQueue {
+		- _fd : int
+		- _handler : IOutputHandler*
+		- _loop : AEventLoop*
+		- _prev : OutputQueue*
+		- _next : OutputQueue*
+		- _deferred : bool
+		- _blocked : bool
+		- _cork : bool
+		- _buffer : vector<char>
+		- _segments : vector<Segment>
+		- _first : size_t
+		- _size : size_t
+		--
+		- send() : int
+		- consume(n : size_t) : void
+		- compact() : void
+		- cork(enabled : bool) : void
+		- defer() : void
+		+ OutputQueue(fd : int, handler : IOutputHandler*)
+		+ attach(loop : AEventLoop&) : void
+		+ detach() : void
+		+ append(data : const void*, len : size_t) : void
+		+ appendRef(data : const void*, len : size_t) : void
+		+ flush() : bool
+		+ clear() : void
+		+ setFd(fd : int) : void
+		+ getFd() : int
+		+ setHandler(handler : IOutputHandler*) : void
+		+ getHandler() : IOutputHandler*
+		+ setCork(enabled : bool) : void
+		+ getCork() : bool
+		+ isDeferred() : bool
+		+ isBlocked() : bool
+		+ size() : size_t
+		+ empty() : bool
+	}
+ * @enduml
+ */
+class OutputQueue
+{
+	public:
+		explicit OutputQueue(int fd = -1, IOutputHandler *handler = NULL);
+		~OutputQueue();
+
+		void			attach(AEventLoop &loop);
+		void			detach();
+
+		void			append(const void *data, std::size_t len);
+		void			appendRef(const void *data, std::size_t len);
+		bool			flush();
+		void			clear();
+
+		void			setFd(int fd);
+		int				getFd() const;
+		void			setHandler(IOutputHandler *handler);
+		IOutputHandler	*getHandler() const;
+		void			setCork(bool enabled);
+		bool			getCork() const;
+		bool			isDeferred() const;
+		bool			isBlocked() const;
+		std::size_t		size() const;
+		bool			empty() const;
+
+	private:
+		friend class AEventLoop;
+
+		/**
+		 * @struct Segment
+		 * @brief Queued fragment, in the owned buffer or in caller memory.
+		 *
+		 * @startuml
+		 * struct "Segment" as Segment {
+				ref : const char*
+				offset : size_t
+				len : size_t
+			}
+		 * @enduml
+		 */
+		struct Segment
+		{
+			const char	*ref;   ///< Caller memory, NULL for the owned buffer
+			std::size_t	offset; ///< Start in the owned buffer, if ref is NULL
+			std::size_t	len;    ///< Bytes left to send
+		};
+
+		/// Most fragments handed to one sendmsg(2).
+		static const std::size_t	MAX_IOV = 64;
+		/// Fewest sent segments dropped at once by compact().
+		static const std::size_t	COMPACT_SEGMENTS = 64;
+		/// Fewest sent bytes of the owned buffer dropped at once by compact().
+		static const std::size_t	COMPACT_BYTES = 4096;
+
+		OutputQueue(const OutputQueue &rhs);
+		OutputQueue &operator=(const OutputQueue &rhs);
+
+		int				send();
+		void			consume(std::size_t n);
+		void			compact();
+		void			cork(bool enabled);
+		void			defer();
+
+		int						_fd;
+		IOutputHandler			*_handler;
+		AEventLoop				*_loop;
+		OutputQueue				*_prev;
+		OutputQueue				*_next;
+		bool					_deferred;
+		bool					_blocked;
+		bool					_cork;
+		std::vector<char>		_buffer;
+		std::vector<Segment>	_segments;
+		std::size_t				_first;
+		std::size_t				_size;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_OUTPUTQUEUE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
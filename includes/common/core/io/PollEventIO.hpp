@@ -13,9 +13,10 @@
 #ifndef COMMON_POLLEVENTIO_HPP
 #define COMMON_POLLEVENTIO_HPP
 
-#include <map>
+#include <cstddef>
 #include <vector>
 #include <poll.h>
+#include <common/core/io/FdTable.hpp>
 #include <common/core/io/IEventIO.hpp>
 
 /**
@@ -23,7 +24,6 @@
  * @brief IEventIO implementation based on poll(2).
  */
 
-
 namespace common
 {
 namespace core
@@ -39,24 +39,37 @@ namespace io
  * Poll is more efficient than select for a large number of descriptors and has no
  * FD_SETSIZE limit.
  *
+ * The pollfd array is kept across calls: add() appends a slot, update()
+ * patches it and remove() moves the last slot into the freed one, all
+ * through a fd-indexed side table. wait() hands the array to the kernel
+ * without rebuilding it. After a wait, the revents fields are scanned
+ * with SSE2 or AVX2 compares where the CPU has them.
+ *
  * @note More performant than select for a large number of descriptors.
  *
  * @startuml
  * class "PollEventIO" as PollEventIO [[classcommon_1_1core_1_1io_1_1_poll_event_i_o.html]] {
-		- _events : map<int, e_Event>
 		- _pollfds : vector<pollfd>
+		- _interests : vector<Interest>
+		- _index : FdTable<size_t>
+		- _ready : ReadyList
 		--
-		- prepareWait() : void
-		- processResults() : void
-		- eventToMask(event : e_Event) : short
-		- maskToEvent(mask : short) : e_Event
+		- setSlot(idx : size_t, fd : int, interest : Interest) : void
+		- slotFd(idx : size_t) : int
+		- processResults(ready : int) : void
+		- {static} eventToMask(event : e_Event) : short
+		- {static} maskToEvent(mask : short) : e_Event
 		+ PollEventIO()
 		+ wait(timeout_ms : int) : int
-		+ add(fd : int, mask : e_Event) : void
+		+ add(fd : int, mask : e_Event, data : void*) : void
 		+ remove(fd : int) : void
 		+ update(fd : int, mask : e_Event) : void
+		+ update(fd : int, mask : e_Event, data : void*) : void
+		+ flush() : void
 		+ clear() : void
 		+ getEvents(fd : int) : e_Event
+		+ getReady() : ReadyList
+		+ getSyscalls() : unsigned long
 	}
  * @enduml
  */
@@ -67,28 +80,122 @@ class PollEventIO : public IEventIO
 		~PollEventIO();
 
 		int		wait(int timeout_ms);
-		void	add(int fd, e_Event mask);
+		void	add(int fd, e_Event mask, void *data = NULL);
 		void	remove(int fd);
 		void	update(int fd, e_Event mask);
+		void	update(int fd, e_Event mask, void *data);
+		void	flush();
 		void	clear();
 		
 		e_Event getEvents(int fd) const;
+		const ReadyList &getReady() const;
+		unsigned long getSyscalls() const;
 
 	private:
 		PollEventIO(const PollEventIO &rhs);
 		PollEventIO &operator=(const PollEventIO &rhs);
 
-		void			prepareWait();
-		void			processResults();
+		void			setSlot(std::size_t idx, int fd, const Interest &interest);
+		int				slotFd(std::size_t idx) const;
+		void			processResults(int ready);
 
-		short			eventToMask(e_Event event) const;
-		e_Event			maskToEvent(short mask) const;
+		static short	eventToMask(e_Event event);
+		static e_Event	maskToEvent(short mask);
 
-		std::map<int, e_Event>		_events;
-		std::map<int, e_Event>		_ready;
 		std::vector<struct pollfd>	_pollfds;
+		std::vector<Interest>		_interests;
+		FdTable<std::size_t>		_index;
+		ReadyList					_ready;
+		unsigned long				_syscalls;
 };
 
+/**
+ * @brief Gets the descriptors reported by the last wait().
+ *
+ * @return Ready list, valid until the next wait() or clear().
+ */
+inline const IEventIO::ReadyList &PollEventIO::getReady() const
+{
+	return (_ready);
+}
+
+/**
+ * @brief Gets the number of system calls made by wait() and flush().
+ *
+ * @return Syscall count since construction. Safe from any thread.
+ */
+inline unsigned long PollEventIO::getSyscalls() const
+{
+	return (__atomic_load_n(&_syscalls, __ATOMIC_RELAXED));
+}
+
+/**
+ * @brief Converts IEventIO event mask to poll(2) event mask.
+ * 
+ *     POLLIN There is data to read.
+              There is some exceptional condition on the file descriptor.
+              Possibilities include:
+
+              •  There is out-of-band data on a TCP socket (see tcp(7)).
+
+              •  A pseudoterminal master in packet mode has seen a state
+                 change on the slave (see ioctl_tty(2)).
+
+              •  A cgroup.events file has been modified (see cgroups(7)).
+
+       POLLOUT
+              Writing is now possible, though a write larger than the
+              available space in a socket or pipe will still block
+              (unless O_NONBLOCK is set).
+
+       POLLERR
+              Error condition (only returned in revents; ignored in
+              events).  This bit is also set for a file descriptor
+              referring to the write end of a pipe when the read end has
+              been closed.
+
+       POLLHUP
+              Hang up (only returned in revents; ignored in events).
+              Note that when reading from a channel such as a pipe or a
+              stream socket, this event merely indicates that the peer
+              closed its end of the channel.  Subsequent reads from the
+              channel will return 0 (end of file) only after all
+              outstanding data in the channel has been consumed.
+ */
+inline short PollEventIO::eventToMask(e_Event event)
+{
+	short mask = 0;
+	
+	if (event & E_IN)
+		mask |= POLLIN;
+	if (event & E_OUT)
+		mask |= POLLOUT;
+	if (event & E_EXCEPT)
+		mask |= POLLERR | POLLHUP;
+	
+	return (mask);
+}
+
+/**
+ * @brief Converts poll(2) event mask to IEventIO event mask.
+ *
+ * @param mask poll(2) event mask.
+ * @return Corresponding IEventIO event mask.
+ */
+inline IEventIO::e_Event PollEventIO::maskToEvent(short mask)
+{
+	e_Event event = E_NONE;
+	
+	if (mask & POLLIN)
+		event = static_cast<e_Event>(event | E_IN);
+	if (mask & POLLOUT)
+		event = static_cast<e_Event>(event | E_OUT);
+	if (mask & (POLLERR | POLLHUP | POLLNVAL))
+		event = static_cast<e_Event>(event | E_EXCEPT);
+	
+	return (event);
+}
+
 } // !io
 } // !core
 } // !common
@@ -13,16 +13,17 @@
 #ifndef COMMON_SELECTEVENTIO_HPP
 #define COMMON_SELECTEVENTIO_HPP
 
-#include <map>
 #include <sys/select.h>
+#include <common/core/io/FdTable.hpp>
 #include <common/core/io/IEventIO.hpp>
+#include <cstddef>
+#include <vector>
 
 /**
  * @file SelectEventIO.hpp
  * @brief IEventIO implementation based on select(2).
  */
 
-
 namespace common
 {
 namespace core
@@ -35,25 +36,46 @@ namespace io
  * @brief I/O event handler using the select(2) system call.
  *
  * This implementation uses select(2) to monitor multiple file descriptors.
- * Select is a portable mechanism but limited by FD_SETSIZE (typically 1024).
  *
- * @note Limited to FD_SETSIZE descriptors. Prefer poll for large sets.
+ * The sets are heap bitmaps of unsigned long words instead of fixed
+ * fd_set structures, grown by add() to cover the highest descriptor and
+ * passed to select(2) as fd_set pointers, so descriptors above
+ * FD_SETSIZE (typically 1024) are accepted. Linux takes any nfds up to
+ * the descriptor limit; macOS needs _DARWIN_UNLIMITED_SELECT, defined by
+ * the implementation file.
+ *
+ * Master read/write/except sets are kept in sync by add(), update() and
+ * remove(); wait() copies the words in use instead of rebuilding them,
+ * and results are scanned a word at a time.
+ *
+ * @note Each wait() costs in proportion to the highest descriptor, not to
+ * the number monitored. Prefer poll or epoll for large sparse sets.
  *
  * @startuml
  * class "SelectEventIO" as SelectEventIO {
-		- _set : map<int, e_Event>
+		- _events : FdTable<Interest>
+		- _ready : ReadyList
+		- _master : Sets
+		- _result : Sets
 		- _nfds : int
+		- _resultWords : size_t
 		--
-		- prepareWait(sets : Sets) : void
-		- processResults(sets : Sets) : void
+		- setMaster(fd : int, mask : e_Event) : void
+		- processResults(ready : int) : void
+		- grow(fd : int) : void
+		- {static} words(nfds : int) : size_t
 		- initTimeout(timeout_ms : int) : timeval
 		+ SelectEventIO()
 		+ wait(timeout_ms : int) : int
-		+ add(fd : int, mask : e_Event) : void
+		+ add(fd : int, mask : e_Event, data : void*) : void
 		+ remove(fd : int) : void
 		+ update(fd : int, mask : e_Event) : void
+		+ update(fd : int, mask : e_Event, data : void*) : void
+		+ flush() : void
 		+ clear() : void
 		+ getEvents(fd : int) : e_Event
+		+ getReady() : ReadyList
+		+ getSyscalls() : unsigned long
 	}
  * @enduml
  */
@@ -64,50 +86,91 @@ class SelectEventIO : public IEventIO
 		~SelectEventIO();
 
 		int		wait(int timeout_ms);
-		void	add(int fd, e_Event mask);
+		void	add(int fd, e_Event mask, void *data = NULL);
 		void	remove(int fd);
 		void	update(int fd, e_Event mask);
+		void	update(int fd, e_Event mask, void *data);
+		void	flush();
 		void	clear();
 		
 		e_Event getEvents(int fd) const;
+		const ReadyList &getReady() const;
+		unsigned long getSyscalls() const;
 
 	private:
 		/**
 		 * @class Sets
-		 * @brief Structure grouping the three fd_set sets for select(2).
+		 * @brief Structure grouping the three descriptor bitmaps for select(2).
+		 *
+		 * Descriptor n is bit n % WORD_BITS of word n / WORD_BITS, which
+		 * is the fd_set layout of glibc and, on little-endian machines, of
+		 * the BSDs and macOS.
 		 *
 		 * @startuml
 		 * struct "Sets" as Sets {
-				fd_set read_fds
-				fd_set write_fds
-				fd_set except_fds
+				_readfds : vector<unsigned long>
+				_writefds : vector<unsigned long>
+				_exceptfds : vector<unsigned long>
 				--
 				Sets()
+				resize(words : size_t) : void
+				zero() : void
 			}
 		 * @enduml
 		 */
 		struct Sets
 		{
-			fd_set _readfds;
-			fd_set _writefds;
-			fd_set _exceptfds;
+			std::vector<unsigned long> _readfds;
+			std::vector<unsigned long> _writefds;
+			std::vector<unsigned long> _exceptfds;
 
 			Sets();
+			void	resize(std::size_t words);
+			void	zero();
 		};
 
 		SelectEventIO(const SelectEventIO &rhs);
 		SelectEventIO &operator=(const SelectEventIO &rhs);
 
-		void			prepareWait(Sets &sets) const;
-		void			processResults(Sets &sets);
+		/// Number of descriptors held by one word of an fd_set.
+		static const int	WORD_BITS = sizeof(unsigned long) * 8;
 
-		struct timeval	initTimeout(int timeout_ms);
+		void			setMaster(int fd, e_Event mask);
+		void			processResults(int ready);
+		void			grow(int fd);
 
-		std::map<int, e_Event>	_events;
-		std::map<int, e_Event>	_ready;
+		static std::size_t		words(int nfds);
+		struct timeval			initTimeout(int timeout_ms);
+
+		FdTable<Interest>		_events;
+		ReadyList				_ready;
+		Sets					_master;
+		Sets					_result;
 		int						_nfds;
+		std::size_t				_resultWords; ///< Result words filled by the last wait()
+		unsigned long			_syscalls;
 };
 
+/**
+ * @brief Gets the descriptors reported by the last wait().
+ *
+ * @return Ready list, valid until the next wait() or clear().
+ */
+inline const IEventIO::ReadyList &SelectEventIO::getReady() const
+{
+	return (_ready);
+}
+
+/**
+ * @brief Gets the number of system calls made by wait() and flush().
+ *
+ * @return Syscall count since construction. Safe from any thread.
+ */
+inline unsigned long SelectEventIO::getSyscalls() const
+{
+	return (__atomic_load_n(&_syscalls, __ATOMIC_RELAXED));
+}
+
 } // !io
 } // !core
 } // !common
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   TaskQueue.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_TASKQUEUE_HPP
+#define COMMON_TASKQUEUE_HPP
+
+/**
+ * @file TaskQueue.hpp
+ * @brief Lock-free multi-producer, single-consumer queue of ATask.
+ */
+
+#include <common/core/io/ATask.hpp>
+#include <cstddef>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class TaskQueue
+ * @brief Intrusive MPSC queue of tasks.
+ *
+ * Producers push onto a lock-free stack with a compare-and-swap; the
+ * consumer takes the whole stack with one atomic exchange and runs it
+ * in posting order. push() reports when the queue was empty, so that
+ * only the first producer of a batch needs to wake the consumer up.
+ *
+ * @startuml
+ * class "TaskQueue" as TaskQueue {
+		- _head : ATask*
+		--
+		+ TaskQueue()
+		+ push(task : ATask*) : bool
+		+ run() : size_t
+		+ empty() : bool
+	}
+ * @enduml
+ */
+class TaskQueue
+{
+	public:
+		TaskQueue();
+		~TaskQueue();
+
+		bool		push(ATask *task);
+		std::size_t	run();
+		bool		empty() const;
+
+	private:
+		TaskQueue(const TaskQueue &rhs);
+		TaskQueue &operator=(const TaskQueue &rhs);
+
+		ATask	*_head;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_TASKQUEUE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ThreadPool.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_THREADPOOL_HPP
+#define COMMON_THREADPOOL_HPP
+
+/**
+ * @file ThreadPool.hpp
+ * @brief Work-stealing thread pool for CPU-bound tasks.
+ */
+
+#include <common/core/io/ATask.hpp>
+#include <common/core/io/WorkDeque.hpp>
+#include <cstddef>
+#include <deque>
+#include <pthread.h>
+#include <vector>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of workers sharing tasks by work stealing.
+ *
+ * Every worker owns a WorkDeque: tasks submitted from a worker go to its
+ * own deque without locking, and idle workers steal from random victims.
+ * Tasks submitted from other threads, such as event loops, go through a
+ * mutex-protected injection queue, touched by workers only when they
+ * run out of local work. Workers with nothing to run or steal park on a
+ * condition variable and are woken one at a time by new submissions.
+ *
+ * Use AOffloadTask to get the result back on the submitting loop.
+ * Tasks are not owned; those still queued when the pool stops are not
+ * run.
+ *
+ * @startuml
+ * class "ThreadPool" as ThreadPool {
+		- _workers : vector<Worker*>
+		- _injection : deque<ATask*>
+		- _injected : size_t
+		- _sleeping : size_t
+		- _running : bool
+		- _mutex : pthread_mutex_t
+		- _cond : pthread_cond_t
+		- _key : pthread_key_t
+		--
+		- {static} threadMain(arg : void*) : void*
+		- work(worker : Worker&) : void
+		- find(worker : Worker&) : ATask*
+		- steal(worker : Worker&) : ATask*
+		- park() : ATask*
+		- hasWork() : bool
+		- wakeOne() : void
+		+ ThreadPool(count : size_t)
+		+ submit(task : ATask*) : void
+		+ stop() : void
+		+ size() : size_t
+	}
+ * @enduml
+ */
+class ThreadPool
+{
+	public:
+		explicit ThreadPool(std::size_t count = 0);
+		~ThreadPool();
+
+		void		submit(ATask *task);
+		void		stop();
+		std::size_t	size() const;
+
+	private:
+		/**
+		 * @struct Worker
+		 * @brief Thread of the pool with its own deque.
+		 *
+		 * @startuml
+		 * struct "Worker" as Worker {
+				pool : ThreadPool*
+				deque : WorkDeque
+				thread : pthread_t
+				seed : unsigned long
+				started : bool
+				--
+				Worker(pool : ThreadPool*, seed : unsigned long)
+			}
+		 * @enduml
+		 */
+		struct Worker
+		{
+			ThreadPool		*pool;
+			WorkDeque		deque;
+			pthread_t		thread;
+			unsigned long	seed;
+			bool			started;
+
+			Worker(ThreadPool *owner, unsigned long init_seed);
+		};
+
+		ThreadPool(const ThreadPool &rhs);
+		ThreadPool &operator=(const ThreadPool &rhs);
+
+		static void	*threadMain(void *arg);
+
+		void		work(Worker &worker);
+		ATask		*find(Worker &worker);
+		ATask		*steal(Worker &worker);
+		ATask		*park();
+		bool		hasWork() const;
+		void		wakeOne();
+
+		std::vector<Worker *>	_workers;
+		std::deque<ATask *>		_injection;
+		std::size_t				_injected;
+		std::size_t				_sleeping;
+		bool					_running;
+		pthread_mutex_t			_mutex;
+		pthread_cond_t			_cond;
+		pthread_key_t			_key;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_THREADPOOL_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
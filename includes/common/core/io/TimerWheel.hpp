@@ -0,0 +1,205 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   TimerWheel.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_TIMERWHEEL_HPP
+#define COMMON_TIMERWHEEL_HPP
+
+/**
+ * @file TimerWheel.hpp
+ * @brief Hashed hierarchical timer wheel with O(1) schedule and cancel.
+ */
+
+#include <common/core/io/ITimerHandler.hpp>
+#include <cstddef>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+class TimerWheel;
+
+/**
+ * @class Timer
+ * @brief Intrusive timer node scheduled on a TimerWheel.
+ *
+ * The timer is owned by the caller, typically embedded in a connection
+ * object, and carries the links of the wheel slot it sits in: scheduling,
+ * rescheduling and cancelling never allocate. A scheduled timer is
+ * cancelled by its destructor.
+ *
+ * @startuml
+ * class "Timer" as Timer {
+		- _handler : ITimerHandler*
+		- _wheel : TimerWheel*
+		- _prev : Timer*
+		- _next : Timer*
+		- _expiry : unsigned long
+		- _level : int
+		- _slot : int
+		--
+		+ Timer(handler : ITimerHandler*)
+		+ setHandler(handler : ITimerHandler*) : void
+		+ getHandler() : ITimerHandler*
+		+ isScheduled() : bool
+		+ getExpiry() : unsigned long
+	}
+ * @enduml
+ */
+class Timer
+{
+	public:
+		explicit Timer(ITimerHandler *handler = NULL);
+		~Timer();
+
+		void			setHandler(ITimerHandler *handler);
+		ITimerHandler	*getHandler() const;
+		bool			isScheduled() const;
+		unsigned long	getExpiry() const;
+
+	private:
+		friend class TimerWheel;
+
+		Timer(const Timer &rhs);
+		Timer &operator=(const Timer &rhs);
+
+		ITimerHandler	*_handler;
+		TimerWheel		*_wheel;
+		Timer			*_prev;
+		Timer			*_next;
+		unsigned long	_expiry;
+		int				_level;
+		int				_slot;
+};
+
+/**
+ * @class TimerWheel
+ * @brief Millisecond timer wheel in the style of the classic kernel timers.
+ *
+ * Timers are hashed by expiry into LEVELS wheels of SLOTS slots each; a
+ * slot of level n spans SLOTS^n milliseconds. Schedule, reschedule and
+ * cancel link or unlink a node in a slot list, whatever the number of
+ * timers. When the lowest wheel wraps around, the current slot of the
+ * next level is cascaded down, so each timer is moved at most LEVELS - 1
+ * times during its life. Deadlines beyond the range of the wheel are
+ * parked in the top level until they get close enough.
+ *
+ * One bit per slot tracks the non-empty slots: advance() jumps over empty
+ * ticks and nextTimeout() inspects one word per level.
+ *
+ * Time is a monotonic millisecond counter supplied by the caller, usually
+ * utils::monotonicMilli(). Delays are relative to the time given to the
+ * last advance(), so timers scheduled from a callback are not skewed by
+ * the ticks still being caught up.
+ *
+ * @startuml
+ * class "TimerWheel" as TimerWheel {
+		- _slots : Timer*[LEVELS][SLOTS]
+		- _occupied : unsigned long[LEVELS]
+		- _current : unsigned long
+		- _now : unsigned long
+		- _size : size_t
+		--
+		- link(timer : Timer&) : void
+		- unlink(timer : Timer&) : void
+		- cascade(level : int, slot : int) : void
+		- expire(tick : unsigned long) : size_t
+		- {static} before(lhs : unsigned long, rhs : unsigned long) : bool
+		+ TimerWheel(now : unsigned long)
+		+ schedule(timer : Timer&, delay_ms : unsigned long) : void
+		+ cancel(timer : Timer&) : void
+		+ advance(now : unsigned long) : size_t
+		+ nextTimeout() : int
+		+ getTime() : unsigned long
+		+ size() : size_t
+		+ empty() : bool
+		+ clear() : void
+	}
+ * @enduml
+ */
+class TimerWheel
+{
+	public:
+		explicit TimerWheel(unsigned long now);
+		~TimerWheel();
+
+		void			schedule(Timer &timer, unsigned long delay_ms);
+		void			cancel(Timer &timer);
+		std::size_t		advance(unsigned long now);
+		int				nextTimeout() const;
+
+		unsigned long	getTime() const;
+		std::size_t		size() const;
+		bool			empty() const;
+		void			clear();
+
+	private:
+		TimerWheel(const TimerWheel &rhs);
+		TimerWheel &operator=(const TimerWheel &rhs);
+
+		/// Bits of the expiry consumed by one level: one slot per bit of a word.
+		static const int			SLOT_BITS = sizeof(unsigned long) == 8 ? 6 : 5;
+		/// Number of slots per level.
+		static const int			SLOTS = 1 << SLOT_BITS;
+		/// Number of levels.
+		static const int			LEVELS = 5;
+		/// Farthest deadline the wheel can hash, in milliseconds.
+		static const unsigned long	MAX_DELAY = (1UL << (SLOT_BITS * LEVELS)) - 1;
+
+		void			link(Timer &timer);
+		void			unlink(Timer &timer);
+		void			cascade(int level, int slot);
+		std::size_t		expire(unsigned long tick);
+
+		static bool		before(unsigned long lhs, unsigned long rhs);
+
+		Timer			*_slots[LEVELS][SLOTS];
+		unsigned long	_occupied[LEVELS];
+		unsigned long	_current;
+		unsigned long	_now;
+		std::size_t		_size;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_TIMERWHEEL_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   WakeupChannel.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_WAKEUPCHANNEL_HPP
+#define COMMON_WAKEUPCHANNEL_HPP
+
+/**
+ * @file WakeupChannel.hpp
+ * @brief Descriptor used to interrupt a thread blocked in IEventIO::wait().
+ */
+
+#include <common/core/io/IEventHandler.hpp>
+#include <common/core/raii/UniqueFd.hpp>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class WakeupChannel
+ * @brief Self-notification descriptor for an event loop.
+ *
+ * Backed by a non-blocking eventfd(2) on Linux and by a non-blocking
+ * pipe elsewhere. getFd() is registered for E_IN on the backend; any
+ * thread calls signal() to make it readable, and the loop thread resets
+ * it through onRead(). Repeated signals coalesce into a single wakeup.
+ *
+ * @startuml
+ * class "WakeupChannel" as WakeupChannel {
+		- _readFd : UniqueFd
+		- _writeFd : UniqueFd
+		--
+		+ WakeupChannel()
+		+ getFd() : int
+		+ signal() : void
+		+ drain() : void
+		+ onRead(fd : int) : void
+		+ onWrite(fd : int) : void
+		+ onError(fd : int) : void
+	}
+ * @enduml
+ */
+class WakeupChannel : public IEventHandler
+{
+	public:
+		WakeupChannel();
+		~WakeupChannel();
+
+		int		getFd() const;
+		void	signal();
+		void	drain();
+
+		void	onRead(int fd);
+		void	onWrite(int fd);
+		void	onError(int fd);
+
+	private:
+		WakeupChannel(const WakeupChannel &rhs);
+		WakeupChannel &operator=(const WakeupChannel &rhs);
+
+		common::core::raii::UniqueFd	_readFd;
+		common::core::raii::UniqueFd	_writeFd;
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_WAKEUPCHANNEL_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
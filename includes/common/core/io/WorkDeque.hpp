@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   WorkDeque.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_WORKDEQUE_HPP
+#define COMMON_WORKDEQUE_HPP
+
+/**
+ * @file WorkDeque.hpp
+ * @brief Chase-Lev work-stealing deque of ATask.
+ */
+
+#include <common/core/io/ATask.hpp>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @class WorkDeque
+ * @brief Lock-free deque owned by one thread and stolen from by others.
+ *
+ * Chase-Lev deque with the memory orderings of Lê et al. (2013). The
+ * owner pushes and takes at the bottom without contention; other threads
+ * steal the oldest task at the top with a single compare-and-swap. The
+ * ring buffer doubles when full. Replaced buffers may still be read by a
+ * concurrent thief, so they are only freed with the deque.
+ *
+ * @startuml
+ * class "WorkDeque" as WorkDeque {
+		- _top : long
+		- _bottom : long
+		- _buffer : Buffer*
+		--
+		- grow(buffer : Buffer*, top : long, bottom : long) : Buffer*
+		+ WorkDeque()
+		+ push(task : ATask*) : void
+		+ take() : ATask*
+		+ steal() : ATask*
+		+ empty() : bool
+	}
+ * @enduml
+ */
+class WorkDeque
+{
+	public:
+		WorkDeque();
+		~WorkDeque();
+
+		void	push(ATask *task);
+		ATask	*take();
+		ATask	*steal();
+		bool	empty() const;
+
+	private:
+		/**
+		 * @struct Buffer
+		 * @brief Ring of task slots, chained to the buffer it replaced.
+		 *
+		 * @startuml
+		 * struct "Buffer" as Buffer {
+				capacity : long
+				slots : ATask**
+				previous : Buffer*
+				--
+				Buffer(capacity : long, previous : Buffer*)
+				~Buffer()
+			}
+		 * @enduml
+		 */
+		struct Buffer
+		{
+			long	capacity;
+			ATask	**slots;
+			Buffer	*previous;
+
+			Buffer(long init_capacity, Buffer *init_previous);
+			~Buffer();
+		};
+
+		WorkDeque(const WorkDeque &rhs);
+		WorkDeque &operator=(const WorkDeque &rhs);
+
+		/// Initial number of slots, a power of two.
+		static const long	INITIAL_CAPACITY = 256;
+		/// Size of a cache line, to keep thieves off the owner's index.
+		static const int	CACHE_LINE = 64;
+
+		Buffer	*grow(Buffer *buffer, long top, long bottom);
+
+		long	_top;
+		char	_padTop[CACHE_LINE - sizeof(long)];
+		long	_bottom;
+		Buffer	*_buffer;
+		char	_padBottom[CACHE_LINE - sizeof(long) - sizeof(Buffer *)];
+};
+
+} // !io
+} // !core
+} // !common
+
+#endif // !COMMON_WORKDEQUE_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
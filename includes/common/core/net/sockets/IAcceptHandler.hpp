@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IAcceptHandler.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_IACCEPTHANDLER_HPP
+#define COMMON_IACCEPTHANDLER_HPP
+
+/**
+ * @file IAcceptHandler.hpp
+ * @brief Interface for objects receiving connections from a ShardedTcpServer.
+ */
+
+#include <common/core/io/AEventLoop.hpp>
+#include <common/core/net/sockets/TcpClient.hpp>
+
+namespace common
+{
+namespace core
+{
+namespace net
+{
+
+/**
+ * @class IAcceptHandler
+ * @brief Callback invoked for each accepted connection.
+ *
+ * Called on the thread of the loop that accepted the connection, so one
+ * handler shared by several loops must be thread-safe. The client is
+ * non-blocking; copying it takes ownership of the descriptor, otherwise
+ * it is closed when the callback returns.
+ *
+ * @startuml
+ * interface "IAcceptHandler" as IAcceptHandler {
+		+ onAccept(loop : AEventLoop&, client : TcpClient&) : void
+	}
+ * @enduml
+ */
+class IAcceptHandler
+{
+	public:
+		virtual ~IAcceptHandler() {};
+
+		virtual void	onAccept(common::core::io::AEventLoop &loop, TcpClient &client) = 0;
+};
+
+} // !net
+} // !core
+} // !common
+
+#endif // !COMMON_IACCEPTHANDLER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
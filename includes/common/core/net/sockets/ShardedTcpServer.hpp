@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ShardedTcpServer.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_SHARDEDTCPSERVER_HPP
+#define COMMON_SHARDEDTCPSERVER_HPP
+
+/**
+ * @file ShardedTcpServer.hpp
+ * @brief One SO_REUSEPORT listener per loop of an EventLoopGroup.
+ */
+
+#include <common/core/io/EventLoop.hpp>
+#include <common/core/io/EventLoopGroup.hpp>
+#include <common/core/io/IEventHandler.hpp>
+#include <common/core/net/sockets/IAcceptHandler.hpp>
+#include <common/core/net/sockets/TcpServer.hpp>
+#include <cstddef>
+#include <sys/socket.h>
+#include <vector>
+
+namespace common
+{
+namespace core
+{
+namespace net
+{
+
+/**
+ * @class ShardedTcpServer
+ * @brief TCP server sharded across the loops of an EventLoopGroup.
+ *
+ * Every loop gets its own non-blocking TcpServer bound to the same
+ * address with SO_REUSEPORT and registered on that loop only. The kernel
+ * spreads incoming connections over the listeners, so loops accept in
+ * parallel without sharing an accept lock. When the address has port 0,
+ * the port picked for the first listener is reused by the others.
+ *
+ * Must be created before the group is started and destroyed after it is
+ * stopped. getAccepted() may be called at any time from any thread.
+ *
+ * @startuml
+ * class "ShardedTcpServer" as ShardedTcpServer {
+		- _listeners : vector<Listener*>
+		--
+		- release() : void
+		+ ShardedTcpServer(group : EventLoopGroup&, addr : sockaddr*, addrlen : socklen_t, handler : IAcceptHandler*, backlog : int)
+		+ size() : size_t
+		+ getServer(shard : size_t) : TcpServer&
+		+ getAccepted(shard : size_t) : unsigned long
+	}
+ * @enduml
+ */
+class ShardedTcpServer
+{
+	public:
+		ShardedTcpServer(common::core::io::EventLoopGroup &group, const struct sockaddr *addr, socklen_t addrlen, IAcceptHandler *handler, int backlog = SOMAXCONN);
+		~ShardedTcpServer();
+
+		std::size_t		size() const;
+		const TcpServer	&getServer(std::size_t shard) const;
+		unsigned long	getAccepted(std::size_t shard) const;
+
+	private:
+		/**
+		 * @struct Listener
+		 * @brief Listening socket of one loop, accepting on readability.
+		 *
+		 * @startuml
+		 * struct "Listener" as Listener {
+				server : TcpServer
+				loop : EventLoop*
+				handler : IAcceptHandler*
+				accepted : unsigned long
+				--
+				Listener(domain : int, loop : EventLoop*, handler : IAcceptHandler*)
+				onRead(fd : int) : void
+				onWrite(fd : int) : void
+				onError(fd : int) : void
+			}
+		 * @enduml
+		 */
+		struct Listener : public common::core::io::IEventHandler
+		{
+			TcpServer						server;
+			common::core::io::EventLoop		*loop;
+			IAcceptHandler					*handler;
+			unsigned long					accepted;
+
+			Listener(int domain, common::core::io::EventLoop *init_loop, IAcceptHandler *init_handler);
+
+			void	onRead(int fd);
+			void	onWrite(int fd);
+			void	onError(int fd);
+		};
+
+		ShardedTcpServer(const ShardedTcpServer &rhs);
+		ShardedTcpServer &operator=(const ShardedTcpServer &rhs);
+
+		/// Maximum number of connections accepted per readiness event.
+		static const int	ACCEPT_BATCH = 64;
+
+		void	release();
+
+		std::vector<Listener *>	_listeners;
+};
+
+} // !net
+} // !core
+} // !common
+
+#endif // !COMMON_SHARDEDTCPSERVER_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
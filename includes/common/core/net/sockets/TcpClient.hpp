@@ -34,6 +34,10 @@ namespace net
  * Provides TCP client functionality including connection establishment.
  * Can be used to connect to remote TCP servers.
  *
+ * setBusyPoll() sets SO_BUSY_POLL where available, letting blocking
+ * receives and polls on the socket spin on the device queue; it pairs
+ * with EventLoop::setBusyPoll() on latency-sensitive connections.
+ *
  * @startuml
  * class "TcpClient" as TcpClient {
 		--
@@ -41,6 +45,7 @@ namespace net
 		+ TcpClient(init_fd : int)
 		+ TcpClient(init_domain : int, init_protocol : int, isNonblock : bool)
 		+ connect(addr : sockaddr, addrlen : socklen_t) : void
+		+ setBusyPoll(usec : int) : bool
 	}
  * @enduml
  */
@@ -56,6 +61,7 @@ class TcpClient : public ATcpSocket
 		TcpClient &operator=(const TcpClient &rhs);
 
 		void	connect(const struct sockaddr *addr, socklen_t addrlen);
+		bool	setBusyPoll(int usec);
 };
 
 } // !net
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Histogram.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef COMMON_HISTOGRAM_HPP
+#define COMMON_HISTOGRAM_HPP
+
+/**
+ * @file Histogram.hpp
+ * @brief Fixed-size log2 histogram, written by one thread and read by any.
+ */
+
+#include <cstddef>
+
+namespace common
+{
+namespace core
+{
+namespace utils
+{
+
+/**
+ * @class Histogram
+ * @brief Distribution of unsigned samples in power-of-two buckets.
+ *
+ * Bucket 0 counts the zeros and bucket i the samples in [2^(i-1), 2^i),
+ * the last one also holding everything larger. record() is a handful of
+ * relaxed stores without locking or allocation, cheap enough to stay on
+ * in production; it must only be called by one thread at a time, while
+ * snapshot() may be called from any thread.
+ *
+ * @startuml
+ * class "Histogram" as Histogram {
+		- _buckets : unsigned long[BUCKETS]
+		- _count : unsigned long
+		- _sum : unsigned long
+		- _max : unsigned long
+		--
+		+ Histogram()
+		+ record(value : unsigned long) : void
+		+ snapshot() : Snapshot
+		+ {static} bucketOf(value : unsigned long) : size_t
+	}
+ * @enduml
+ */
+class Histogram
+{
+	public:
+		/// Number of buckets.
+		static const std::size_t	BUCKETS = 32;
+
+		/**
+		 * @struct Snapshot
+		 * @brief Copy of a histogram, with its summary statistics.
+		 *
+		 * @startuml
+		 * struct "Snapshot" as Snapshot {
+				buckets : unsigned long[BUCKETS]
+				count : unsigned long
+				sum : unsigned long
+				max : unsigned long
+				--
+				Snapshot()
+				mean() : unsigned long
+				percentile(p : double) : unsigned long
+				merge(other : Snapshot) : void
+			}
+		 * @enduml
+		 */
+		struct Snapshot
+		{
+			unsigned long	buckets[BUCKETS]; ///< Samples per bucket
+			unsigned long	count;            ///< Number of samples
+			unsigned long	sum;              ///< Sum of the samples
+			unsigned long	max;              ///< Largest sample
+
+			Snapshot();
+
+			unsigned long	mean() const;
+			unsigned long	percentile(double p) const;
+			void			merge(const Snapshot &other);
+		};
+
+		Histogram();
+		~Histogram();
+
+		void		record(unsigned long value);
+		Snapshot	snapshot() const;
+
+		static std::size_t	bucketOf(unsigned long value);
+
+	private:
+		Histogram(const Histogram &rhs);
+		Histogram &operator=(const Histogram &rhs);
+
+		unsigned long	_buckets[BUCKETS];
+		unsigned long	_count;
+		unsigned long	_sum;
+		unsigned long	_max;
+};
+
+} // !utils
+} // !core
+} // !common
+
+#endif // !COMMON_HISTOGRAM_HPP
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
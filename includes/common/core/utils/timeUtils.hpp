@@ -30,6 +30,9 @@ namespace utils
 
 std::time_t nowSec();
 long 		nowMilli();
+unsigned long	monotonicMilli();
+unsigned long	monotonicMicro();
+unsigned long	monotonicNano();
 double		relativeSec(const clock_t &startTime);
 std::string	timestamp(const time_t &time);
 
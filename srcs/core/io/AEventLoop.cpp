@@ -0,0 +1,392 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   AEventLoop.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/AEventLoop.hpp>
+#include <common/core/io/OutputQueue.hpp>
+#include <common/core/utils/timeUtils.hpp>
+#include <cerrno>
+#include <cstddef>
+#include <stdexcept>
+
+/**
+ * @file AEventLoop.cpp
+ * @brief Implementation of the backend-independent part of the reactor.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+const std::size_t	AEventLoop::DEFAULT_MAX_EVENTS;
+
+/**
+ * @brief Constructor. Creates the timer wheel on the monotonic clock.
+ *
+ * @throw std::runtime_error If the wakeup channel cannot be created.
+ */
+AEventLoop::AEventLoop() : _timers(utils::monotonicMilli()), _wakeup(), _tasks(), _stats(), _readyHistogram(), _dispatchHistogram(), _instrumented(false), _busyPollMax(0), _busyPollBudget(0), _interArrival(0), _lastArrival(0), _cursor(0), _maxEvents(DEFAULT_MAX_EVENTS), _running(false), _deferredHead(NULL), _deferredTail(NULL) {}
+
+/**
+ * @brief Constructor. Zeroes the counters.
+ */
+AEventLoop::Stats::Stats()
+	: iterations(0), events(0), timers(0), tasks(0), waits(0), waitTime(0), dispatchTime(0), syscalls(0), busyPolls(0), busyPollHits(0), flushes(0),
+	readyPerWait(), dispatchLatency() {}
+
+/**
+ * @brief Destructor. Detaches the queues still waiting for a flush.
+ */
+AEventLoop::~AEventLoop()
+{
+	while (_deferredHead)
+		_deferredHead->detach();
+}
+
+/**
+ * @brief Schedules or reschedules a timer on the loop.
+ *
+ * @param timer Timer to schedule, its handler runs on the loop thread.
+ * @param delay_ms Delay in milliseconds from the current loop time.
+ */
+void	AEventLoop::schedule(Timer &timer, unsigned long delay_ms)
+{
+	_timers.schedule(timer, delay_ms);
+}
+
+/**
+ * @brief Cancels a timer scheduled on the loop.
+ *
+ * @param timer Timer to cancel.
+ */
+void	AEventLoop::cancel(Timer &timer)
+{
+	_timers.cancel(timer);
+}
+
+/**
+ * @brief Queues a task to run on the loop thread. Safe from any thread.
+ *
+ * @param task Task to run, not owned.
+ * @throw std::runtime_error If task is NULL.
+ */
+void	AEventLoop::post(ATask *task)
+{
+	if (task == NULL)
+		throw std::runtime_error("EventLoop: NULL task");
+	if (_tasks.push(task))
+		_wakeup.signal();
+}
+
+/**
+ * @brief Interrupts the current or next wait. Safe from any thread.
+ */
+void	AEventLoop::wakeup()
+{
+	_wakeup.signal();
+}
+
+/**
+ * @brief Makes run() return after the current iteration. Safe from any
+ * thread: a blocking wait is interrupted.
+ */
+void	AEventLoop::stop()
+{
+	__atomic_store_n(&_running, false, __ATOMIC_RELEASE);
+	_wakeup.signal();
+}
+
+/**
+ * @brief Tells whether run() is looping.
+ *
+ * @return true between run() and stop().
+ */
+bool	AEventLoop::isRunning() const
+{
+	return (__atomic_load_n(&_running, __ATOMIC_ACQUIRE));
+}
+
+/**
+ * @brief Turns the timing of waits and dispatches on or off. Safe from
+ * any thread, effective from the next iteration.
+ *
+ * @param enabled true to time waits and events.
+ */
+void	AEventLoop::setInstrumented(bool enabled)
+{
+	__atomic_store_n(&_instrumented, enabled, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Tells whether waits and dispatches are timed.
+ *
+ * @return true if instrumented.
+ */
+bool	AEventLoop::isInstrumented() const
+{
+	return (__atomic_load_n(&_instrumented, __ATOMIC_RELAXED));
+}
+
+/**
+ * @brief Enables or disables the spin phase before blocking waits. Safe
+ * from any thread, effective from the next iteration.
+ *
+ * The spin budget adapts between 0 and max_us to the observed interval
+ * between events. Spinning burns the loop thread's CPU while it lasts and
+ * only pays off when that thread has a core of its own.
+ *
+ * @param max_us Longest spin in microseconds, 0 to disable (the default).
+ */
+void	AEventLoop::setBusyPoll(unsigned long max_us)
+{
+	__atomic_store_n(&_busyPollMax, max_us * 1000, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Gets the longest spin before a blocking wait.
+ *
+ * @return Maximum spin in microseconds, 0 if disabled.
+ */
+unsigned long	AEventLoop::getBusyPoll() const
+{
+	return (__atomic_load_n(&_busyPollMax, __ATOMIC_RELAXED) / 1000);
+}
+
+/**
+ * @brief Sets the maximum number of events dispatched per iteration.
+ *
+ * @param max Event cap, 0 restores the default.
+ */
+void	AEventLoop::setMaxEvents(std::size_t max)
+{
+	_maxEvents = max ? max : DEFAULT_MAX_EVENTS;
+}
+
+/**
+ * @brief Gets the maximum number of events dispatched per iteration.
+ *
+ * @return Event cap.
+ */
+std::size_t	AEventLoop::getMaxEvents() const
+{
+	return (_maxEvents);
+}
+
+/**
+ * @brief Gets the timer wheel of the loop.
+ *
+ * @return Timer wheel reference.
+ */
+TimerWheel	&AEventLoop::getTimers()
+{
+	return (_timers);
+}
+
+/**
+ * @brief Queues an output queue for the flush at the end of the current
+ * iteration. Called by OutputQueue::append() on an attached queue.
+ *
+ * Queues are flushed in the order they were deferred. Deferring an
+ * already deferred queue does nothing.
+ *
+ * @param queue Queue to flush, not owned.
+ */
+void	AEventLoop::defer(OutputQueue &queue)
+{
+	if (queue._deferred)
+		return ;
+	queue._prev = _deferredTail;
+	queue._next = NULL;
+	if (_deferredTail)
+		_deferredTail->_next = &queue;
+	else
+		_deferredHead = &queue;
+	_deferredTail = &queue;
+	queue._deferred = true;
+}
+
+/**
+ * @brief Withdraws an output queue from the next flush.
+ *
+ * @param queue Queue to withdraw, ignored if not deferred.
+ */
+void	AEventLoop::undefer(OutputQueue &queue)
+{
+	if (queue._deferred == false)
+		return ;
+	if (queue._prev)
+		queue._prev->_next = queue._next;
+	else
+		_deferredHead = queue._next;
+	if (queue._next)
+		queue._next->_prev = queue._prev;
+	else
+		_deferredTail = queue._prev;
+	queue._prev = NULL;
+	queue._next = NULL;
+	queue._deferred = false;
+}
+
+/**
+ * @brief Copies the backend-independent counters. Safe from any thread.
+ *
+ * @param stats Receives the counters, except syscalls which belongs to
+ *        the backend.
+ */
+void	AEventLoop::snapshot(Stats &stats) const
+{
+	stats.iterations = __atomic_load_n(&_stats.iterations, __ATOMIC_RELAXED);
+	stats.events = __atomic_load_n(&_stats.events, __ATOMIC_RELAXED);
+	stats.timers = __atomic_load_n(&_stats.timers, __ATOMIC_RELAXED);
+	stats.tasks = __atomic_load_n(&_stats.tasks, __ATOMIC_RELAXED);
+	stats.waits = __atomic_load_n(&_stats.waits, __ATOMIC_RELAXED);
+	stats.waitTime = __atomic_load_n(&_stats.waitTime, __ATOMIC_RELAXED);
+	stats.dispatchTime = __atomic_load_n(&_stats.dispatchTime, __ATOMIC_RELAXED);
+	stats.busyPolls = __atomic_load_n(&_stats.busyPolls, __ATOMIC_RELAXED);
+	stats.busyPollHits = __atomic_load_n(&_stats.busyPollHits, __ATOMIC_RELAXED);
+	stats.flushes = __atomic_load_n(&_stats.flushes, __ATOMIC_RELAXED);
+	stats.readyPerWait = _readyHistogram.snapshot();
+	stats.dispatchLatency = _dispatchHistogram.snapshot();
+}
+
+/**
+ * @brief Bounds a wait timeout by the next timer deadline.
+ *
+ * Pending tasks make the wait non-blocking: their wakeup may already
+ * have been consumed by a previous iteration. So do queues waiting for a
+ * flush.
+ *
+ * @param timeout_ms Requested timeout (-1 for infinite).
+ * @return Timeout to pass to IEventIO::wait().
+ */
+int	AEventLoop::waitTimeout(int timeout_ms) const
+{
+	int next = _timers.nextTimeout();
+
+	if (_tasks.empty() == false || _deferredHead != NULL)
+		return (0);
+	if (next < 0 || (timeout_ms >= 0 && timeout_ms < next))
+		return (timeout_ms);
+	return (next);
+}
+
+/**
+ * @brief Updates the spin budget from the time since the previous wakeup
+ * that found events.
+ *
+ * The interval feeds a moving average weighted 1/8, clamped to four
+ * times the maximum spin so one long idle period is forgotten within a
+ * few events. The budget is twice the average, capped by the maximum,
+ * and drops to 0 while the average exceeds the maximum.
+ *
+ * @param now Monotonic time of the wakeup, in nanoseconds.
+ */
+void	AEventLoop::adapt(unsigned long now)
+{
+	const unsigned long max = __atomic_load_n(&_busyPollMax, __ATOMIC_RELAXED);
+
+	if (_lastArrival != 0)
+	{
+		unsigned long gap = now - _lastArrival;
+
+		if (gap > 4 * max)
+			gap = 4 * max;
+		if (_interArrival == 0)
+			_interArrival = gap;
+		else
+			_interArrival = _interArrival - _interArrival / 8 + gap / 8;
+		if (_interArrival > max)
+			_busyPollBudget = 0;
+		else
+			_busyPollBudget = 2 * _interArrival < max ? 2 * _interArrival : max;
+	}
+	_lastArrival = now;
+}
+
+/**
+ * @brief Flushes the output queues deferred before this call.
+ *
+ * Each queue is withdrawn, then sends what it holds. A queue the socket
+ * did not drain is blocked, so that appends do not defer it again before
+ * a flush() drains it, and reported through IOutputHandler::onBlocked().
+ * A failed write is reported through IOutputHandler::onError() after the
+ * queue is cleared.
+ * Only the queues deferred before the call are flushed: those deferred
+ * by these callbacks wait for the next iteration, which then does not
+ * block.
+ *
+ * @return Number of queues flushed.
+ */
+std::size_t	AEventLoop::flushDeferred()
+{
+	std::size_t pending = 0;
+	std::size_t flushes = 0;
+
+	for (OutputQueue *queue = _deferredHead; queue; queue = queue->_next)
+		++pending;
+	while (flushes < pending && _deferredHead)
+	{
+		OutputQueue &queue = *_deferredHead;
+		IOutputHandler *handler = queue.getHandler();
+		int error;
+
+		undefer(queue);
+		error = queue.send();
+		++flushes;
+		if (error == EAGAIN || error == EWOULDBLOCK)
+		{
+			queue._blocked = true;
+			if (handler)
+				handler->onBlocked(queue);
+		}
+		else if (error != 0)
+		{
+			queue.clear();
+			if (handler)
+				handler->onError(queue, error);
+		}
+	}
+	return (flushes);
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
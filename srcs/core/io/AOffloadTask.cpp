@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   AOffloadTask.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/AOffloadTask.hpp>
+
+/**
+ * @file AOffloadTask.cpp
+ * @brief Implementation of the pool-to-loop offload task.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @brief Constructor.
+ *
+ * @param origin Loop on which complete() runs.
+ */
+AOffloadTask::AOffloadTask(AEventLoop &origin) : ATask(), _origin(&origin), _executed(false) {}
+
+/**
+ * @brief Virtual destructor for polymorphic cleanup.
+ */
+AOffloadTask::~AOffloadTask() {}
+
+/**
+ * @brief Runs the phase matching the calling side.
+ *
+ * The first run, on a pool worker, calls execute() and posts the task to
+ * the originating loop; the second, on the loop thread, calls complete().
+ */
+void	AOffloadTask::run()
+{
+	if (_executed == false)
+	{
+		_executed = true;
+		execute();
+		_origin->post(this);
+	}
+	else
+	{
+		_executed = false;
+		complete();
+	}
+}
+
+/**
+ * @brief Gets the loop on which complete() runs.
+ *
+ * @return Originating loop.
+ */
+AEventLoop	&AOffloadTask::getOrigin() const
+{
+	return (*_origin);
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,229 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   AcceptMutex.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/AcceptMutex.hpp>
+#include <cerrno>
+#include <csignal>
+#include <pthread.h>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * @file AcceptMutex.cpp
+ * @brief Implementation of the inter-process accept lock.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+#if defined(__linux__)
+/**
+ * @brief Gets the kernel id of the calling thread, unique across
+ * processes while the thread lives.
+ *
+ * @return Thread id.
+ */
+static pid_t	currentThread()
+{
+	return (static_cast<pid_t>(::syscall(SYS_gettid)));
+}
+
+/**
+ * @brief Tells whether a thread of the calling process is recorded as
+ * the holder. The pid is compared too, in case the id of a dead holder
+ * was reused by another process.
+ *
+ * @param owner Recorded holder process.
+ * @param holder Recorded holder thread.
+ * @param thread Thread to test.
+ * @return true if @p thread of this process is the holder.
+ */
+static bool	isHolder(pid_t owner, pid_t holder, pid_t thread)
+{
+	return (holder == thread && owner == ::getpid());
+}
+#endif
+
+/**
+ * @brief Constructor. Maps the shared lock, unlocked.
+ *
+ * @throw std::runtime_error If mmap or the mutex initialisation fails.
+ */
+AcceptMutex::AcceptMutex() : _state(NULL)
+{
+	void *map = ::mmap(NULL, sizeof(State), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+	if (map == MAP_FAILED)
+		throw std::runtime_error("mmap failed: " + std::string(std::strerror(errno)));
+	_state = static_cast<State *>(map);
+	_state->owner = 0;
+#if defined(__linux__)
+	_state->thread = 0;
+	pthread_mutexattr_t attr;
+	int err = pthread_mutexattr_init(&attr);
+
+	if (err == 0)
+		err = pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+	if (err == 0)
+		err = pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+	if (err == 0)
+		err = pthread_mutex_init(&_state->mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+	if (err != 0)
+	{
+		::munmap(_state, sizeof(State));
+		throw std::runtime_error("pthread_mutex_init failed: " + std::string(std::strerror(err)));
+	}
+#endif
+}
+
+/**
+ * @brief Destructor. Releases the lock if the calling thread holds it,
+ * then unmaps it from this process. The mutex is not destroyed: the
+ * other processes may still use it, and it goes away with the last
+ * mapping.
+ */
+AcceptMutex::~AcceptMutex()
+{
+	unlock();
+	::munmap(_state, sizeof(State));
+}
+
+/**
+ * @brief Takes the lock if it is free, already held by the caller or
+ * left by a holder that died. Never blocks.
+ *
+ * @return true if the caller holds the lock: the calling thread on
+ *         Linux, the calling process elsewhere.
+ */
+bool	AcceptMutex::tryLock()
+{
+#if defined(__linux__)
+	const pid_t thread = currentThread();
+	int err;
+
+	if (isHolder(__atomic_load_n(&_state->owner, __ATOMIC_ACQUIRE),
+			__atomic_load_n(&_state->thread, __ATOMIC_ACQUIRE), thread))
+		return (true);
+	err = pthread_mutex_trylock(&_state->mutex);
+	if (err == EOWNERDEAD)
+		err = pthread_mutex_consistent(&_state->mutex);
+	if (err != 0)
+		return (false);
+	__atomic_store_n(&_state->owner, ::getpid(), __ATOMIC_RELEASE);
+	__atomic_store_n(&_state->thread, thread, __ATOMIC_RELEASE);
+	return (true);
+#else
+	const pid_t self = ::getpid();
+	pid_t owner = __atomic_load_n(&_state->owner, __ATOMIC_ACQUIRE);
+
+	if (owner == self)
+		return (true);
+	if (owner != 0 && (::kill(owner, 0) == 0 || errno != ESRCH))
+		return (false);
+	return (__atomic_compare_exchange_n(&_state->owner, &owner, self, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+#endif
+}
+
+/**
+ * @brief Releases the lock. Does nothing unless the caller holds it.
+ *
+ * The holder is cleared before the mutex is released, so that the next
+ * holder cannot be overwritten, and restored if the release fails.
+ */
+void	AcceptMutex::unlock()
+{
+#if defined(__linux__)
+	const pid_t thread = currentThread();
+	const pid_t owner = __atomic_load_n(&_state->owner, __ATOMIC_ACQUIRE);
+
+	if (isHolder(owner, __atomic_load_n(&_state->thread, __ATOMIC_ACQUIRE), thread) == false)
+		return ;
+	__atomic_store_n(&_state->thread, 0, __ATOMIC_RELEASE);
+	__atomic_store_n(&_state->owner, 0, __ATOMIC_RELEASE);
+	if (pthread_mutex_unlock(&_state->mutex) != 0)
+	{
+		__atomic_store_n(&_state->owner, owner, __ATOMIC_RELEASE);
+		__atomic_store_n(&_state->thread, thread, __ATOMIC_RELEASE);
+	}
+#else
+	pid_t self = ::getpid();
+
+	__atomic_compare_exchange_n(&_state->owner, &self, 0, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ * @brief Tells whether the caller holds the lock.
+ *
+ * @return true between a successful tryLock() and unlock() of the
+ *         calling thread on Linux, of the calling process elsewhere.
+ */
+bool	AcceptMutex::isHeld() const
+{
+#if defined(__linux__)
+	return (isHolder(__atomic_load_n(&_state->owner, __ATOMIC_ACQUIRE),
+		__atomic_load_n(&_state->thread, __ATOMIC_ACQUIRE), currentThread()));
+#else
+	return (__atomic_load_n(&_state->owner, __ATOMIC_ACQUIRE) == ::getpid());
+#endif
+}
+
+/**
+ * @brief Gets the process holding the lock.
+ *
+ * @return Pid of the holder, 0 if the lock is free. A holder that died
+ *         stays reported until the lock is taken over.
+ */
+pid_t	AcceptMutex::getOwner() const
+{
+	return (__atomic_load_n(&_state->owner, __ATOMIC_ACQUIRE));
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,399 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   EpollEventIO.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/IEventIO.hpp>
+#include <common/core/io/EpollEventIO.hpp>
+
+/**
+ * @file EpollEventIO.cpp
+ * @brief Implementation of epoll(7)-based I/O event handler.
+ */
+
+#if defined(__linux__)
+
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+#include <string>
+#include <sys/epoll.h>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+const std::size_t	EpollEventIO::MAX_EVENTS;
+
+/**
+ * @brief Default constructor. Creates the epoll instance.
+ *
+ * @throw std::runtime_error If epoll_create1 fails.
+ */
+EpollEventIO::EpollEventIO() : _epfd(::epoll_create1(EPOLL_CLOEXEC)), _events(), _ready(), _epevents(), _changes(), _syscalls(0)
+{
+	if (_epfd.valid() == false)
+		throw std::runtime_error("epoll_create1 failed: " + std::string(std::strerror(errno)));
+}
+
+/**
+ * @brief Constructor. Creates an entry with no interest and no event.
+ */
+EpollEventIO::Entry::Entry() : events(E_NONE), ready(E_NONE), kernel(E_NONE), data(NULL), active(false), registered(false), queued(false) {}
+
+/**
+ * @brief Destructor. The epoll descriptor is closed by its UniqueFd.
+ */
+EpollEventIO::~EpollEventIO() {}
+
+/**
+ * @brief Waits for events on monitored file descriptors.
+ *
+ * Flushes the changelist first. The result buffer grows with the interest
+ * set up to MAX_EVENTS entries. When more descriptors are ready, the
+ * remaining ones are reported by the next call.
+ *
+ * @param timeout_ms Timeout in milliseconds (-1 for infinite, 0 for non-blocking).
+ * @return Number of entries in the ready list, or 0 on timeout.
+ * @throw std::runtime_error If epoll_wait fails.
+ */
+int	EpollEventIO::wait(int timeout_ms)
+{
+	int ready;
+
+	for (ReadyList::const_iterator it = _ready.begin(); it != _ready.end(); ++it)
+		if (Entry *entry = _events.find(it->fd))
+			entry->ready = E_NONE;
+	_ready.clear();
+	flush();
+	if (_events.empty())
+		return (static_cast<int>(_ready.size()));
+	if (_epevents.size() < _events.size() && _epevents.size() < MAX_EVENTS)
+		_epevents.resize(_events.size() < MAX_EVENTS ? _events.size() : MAX_EVENTS);
+	if (_ready.empty() == false)
+		timeout_ms = 0;
+	countSyscall(_syscalls);
+	if ((ready = ::epoll_wait(_epfd.get(), &_epevents[0], static_cast<int>(_epevents.size()), timeout_ms)) == -1)
+		throw std::runtime_error("epoll_wait failed: " + std::string(std::strerror(errno)));
+	if (ready)
+		processResults(ready);
+	return (static_cast<int>(_ready.size()));
+}
+
+/**
+ * @brief Adds a file descriptor to monitor for events.
+ *
+ * Adding an already monitored descriptor replaces its event mask and
+ * user pointer. The registration is always sent to the kernel, in case
+ * the descriptor number now refers to a new file.
+ *
+ * @param fd File descriptor to add.
+ * @param mask Event mask to monitor (E_IN, E_OUT, E_EXCEPT, E_EDGE, E_ONESHOT,
+ *        E_EXCLUSIVE).
+ * @param data User pointer returned with the descriptor's ready events.
+ * @throw std::out_of_range If fd is negative.
+ */
+void EpollEventIO::add(int fd, e_Event mask, void *data)
+{
+	Entry *entry = _events.find(fd);
+
+	if (entry == NULL)
+		entry = &_events.insert(fd, Entry());
+	entry->events = mask;
+	entry->kernel = E_NONE;
+	entry->data = data;
+	entry->active = true;
+	queue(fd, *entry);
+}
+
+/**
+ * @brief Removes a file descriptor from monitoring.
+ *
+ * A pending entry in the ready list is kept but reported as E_NONE, so
+ * that a caller iterating getReady() can remove descriptors safely.
+ *
+ * @param fd File descriptor to remove.
+ */
+void EpollEventIO::remove(int fd)
+{
+	Entry *entry = _events.find(fd);
+
+	if (entry == NULL || entry->active == false)
+		return ;
+	for (ReadyList::iterator rit = _ready.begin(); rit != _ready.end(); ++rit)
+		if (rit->fd == fd)
+			rit->events = E_NONE;
+	entry->active = false;
+	entry->ready = E_NONE;
+	entry->data = NULL;
+	if (entry->registered)
+		queue(fd, *entry);
+	else if (entry->queued == false)
+		_events.erase(fd);
+}
+
+/**
+ * @brief Updates the event mask for a monitored file descriptor.
+ *
+ * Keeps the user pointer. Queues a change only when the mask differs from
+ * the one armed in the kernel, which includes re-arming an E_ONESHOT
+ * descriptor that fired.
+ *
+ * @param fd File descriptor to update.
+ * @param mask New event mask.
+ */
+void EpollEventIO::update(int fd, e_Event mask)
+{
+	Entry *entry = _events.find(fd);
+
+	if (entry == NULL || entry->active == false)
+		return ;
+	entry->events = mask;
+	if (entry->registered == false || entry->kernel != mask)
+		queue(fd, *entry);
+}
+
+/**
+ * @brief Updates the event mask and user pointer for a monitored file descriptor.
+ *
+ * The user pointer is kept on the user side, so only a mask change
+ * reaches the kernel.
+ *
+ * @param fd File descriptor to update.
+ * @param mask New event mask.
+ * @param data New user pointer.
+ */
+void EpollEventIO::update(int fd, e_Event mask, void *data)
+{
+	Entry *entry = _events.find(fd);
+
+	if (entry == NULL || entry->active == false)
+		return ;
+	entry->data = data;
+	update(fd, mask);
+}
+
+/**
+ * @brief Applies the changelist.
+ *
+ * Each queued descriptor costs at most one epoll_ctl(2), none if its
+ * wanted state matches the kernel. Rejected changes are appended to the
+ * ready list as E_EXCEPT events.
+ */
+void EpollEventIO::flush()
+{
+	for (std::vector<int>::const_iterator it = _changes.begin(); it != _changes.end(); ++it)
+	{
+		Entry *entry = _events.find(*it);
+
+		if (entry == NULL || entry->queued == false)
+			continue ;
+		entry->queued = false;
+		apply(*it, *entry);
+	}
+	_changes.clear();
+}
+
+/**
+ * @brief Removes all monitored file descriptors.
+ *
+ * The epoll instance is recreated, which drops every registration at once.
+ *
+ * @throw std::runtime_error If epoll_create1 fails.
+ */
+void EpollEventIO::clear()
+{
+	_epfd.reset(::epoll_create1(EPOLL_CLOEXEC));
+	_events.clear();
+	_ready.clear();
+	_epevents.clear();
+	_changes.clear();
+	if (_epfd.valid() == false)
+		throw std::runtime_error("epoll_create1 failed: " + std::string(std::strerror(errno)));
+}
+
+/**
+ * @brief Gets the detected events for a file descriptor.
+ *
+ * @param fd File descriptor to query.
+ * @return Detected event mask (E_NONE if fd not monitored).
+ */
+IEventIO::e_Event EpollEventIO::getEvents(int fd) const
+{
+	const Entry *entry = _events.find(fd);
+	if (entry == NULL || entry->active == false)
+		return (E_NONE);
+	return (entry->ready);
+}
+
+/**
+ * @brief Puts a descriptor in the changelist, once.
+ *
+ * @param fd File descriptor concerned.
+ * @param entry Entry of the descriptor.
+ */
+void EpollEventIO::queue(int fd, Entry &entry)
+{
+	if (entry.queued)
+		return ;
+	entry.queued = true;
+	_changes.push_back(fd);
+}
+
+/**
+ * @brief Brings the kernel registration of a descriptor to its wanted state.
+ *
+ * A descriptor closed since it was registered has been dropped by the
+ * kernel: EBADF and ENOENT are ignored on removal, and a modification
+ * failing with ENOENT is retried as an addition (EEXIST the other way).
+ * EPOLLEXCLUSIVE registrations cannot be modified: a modification
+ * failing with EINVAL is retried as a removal and an addition.
+ * Any other failure drops the descriptor and reports it as E_EXCEPT.
+ *
+ * @param fd File descriptor concerned.
+ * @param entry Entry of the descriptor.
+ */
+void EpollEventIO::apply(int fd, Entry &entry)
+{
+	ReadyEvent ev;
+	int err;
+
+	if (entry.active == false)
+	{
+		if (entry.registered)
+		{
+			countSyscall(_syscalls);
+			::epoll_ctl(_epfd.get(), EPOLL_CTL_DEL, fd, NULL);
+		}
+		_events.erase(fd);
+		return ;
+	}
+	if (entry.registered && entry.kernel == entry.events)
+		return ;
+	err = ctl(entry.registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, entry.events);
+	if (err == EINVAL && entry.registered)
+	{
+		countSyscall(_syscalls);
+		::epoll_ctl(_epfd.get(), EPOLL_CTL_DEL, fd, NULL);
+		err = ctl(EPOLL_CTL_ADD, fd, entry.events);
+	}
+	else if (err == ENOENT && entry.registered)
+		err = ctl(EPOLL_CTL_ADD, fd, entry.events);
+	else if (err == EEXIST && entry.registered == false)
+		err = ctl(EPOLL_CTL_MOD, fd, entry.events);
+	if (err == 0)
+	{
+		entry.registered = true;
+		entry.kernel = entry.events;
+		return ;
+	}
+	ev.fd = fd;
+	ev.events = E_EXCEPT;
+	ev.data = entry.data;
+	_ready.push_back(ev);
+	if (entry.registered)
+	{
+		countSyscall(_syscalls);
+		::epoll_ctl(_epfd.get(), EPOLL_CTL_DEL, fd, NULL);
+	}
+	_events.erase(fd);
+}
+
+/**
+ * @brief Issues an epoll_ctl(2) call for a file descriptor.
+ *
+ * @param op EPOLL_CTL_ADD or EPOLL_CTL_MOD.
+ * @param fd File descriptor concerned.
+ * @param mask Event mask to register.
+ * @return 0 on success, errno otherwise.
+ */
+int EpollEventIO::ctl(int op, int fd, e_Event mask)
+{
+	struct epoll_event ev;
+
+	std::memset(&ev, 0, sizeof(ev));
+	ev.events = eventToMask(mask);
+	ev.data.fd = fd;
+	countSyscall(_syscalls);
+	if (::epoll_ctl(_epfd.get(), op, fd, &ev) == -1)
+		return (errno);
+	return (0);
+}
+
+/**
+ * @brief Appends the epoll_wait(2) results to the ready list.
+ *
+ * Only the @p count returned entries are visited. A reported E_ONESHOT
+ * descriptor is disarmed in the kernel, so its armed mask is cleared and
+ * the next update() re-arms it. EPOLLET keeps an E_EDGE descriptor armed,
+ * so its mask is left alone and an update() with the same mask costs no
+ * system call.
+ *
+ * @param count Number of entries filled by epoll_wait(2).
+ */
+void EpollEventIO::processResults(int count)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		e_Event mask = maskToEvent(_epevents[i].events);
+		if (mask)
+		{
+			ReadyEvent ev;
+			ev.fd = _epevents[i].data.fd;
+			ev.events = mask;
+			ev.data = NULL;
+			if (Entry *entry = _events.find(ev.fd))
+			{
+				entry->ready = mask;
+				if (entry->kernel & E_ONESHOT)
+					entry->kernel = disarm(entry->kernel, mask);
+				ev.data = entry->data;
+			}
+			_ready.push_back(ev);
+		}
+	}
+}
+
+} // !io
+} // !core
+} // !common
+
+#endif // __linux__
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
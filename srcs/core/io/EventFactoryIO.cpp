@@ -12,9 +12,21 @@
 
 #include <common/core/io/SelectEventIO.hpp>
 #include <common/core/io/PollEventIO.hpp>
+#include <common/core/io/EpollEventIO.hpp>
+#include <common/core/io/IoUringEventIO.hpp>
 #include <common/core/raii/UniquePtr.hpp>
 #include <common/core/io/EventFactoryIO.hpp>
+#include <common/core/io/FdTable.hpp>
+#include <common/core/utils/timeUtils.hpp>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
 #include <stdexcept>
+#include <string>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
 
 /**
  * @file EventFactoryIO.cpp
@@ -29,6 +41,11 @@ namespace core
 namespace io
 {
 
+const std::size_t	EventFactoryIO::SELECT_MAX_FDS;
+const std::size_t	EventFactoryIO::CALIBRATION_SPREAD;
+int					EventFactoryIO::_calibrated = -1;
+std::size_t			EventFactoryIO::_calibratedFds = 0;
+
 /**
  * @brief Private constructor to prevent instantiation.
  *
@@ -49,21 +66,166 @@ EventFactoryIO::~EventFactoryIO() {}
  * The caller must manage memory, ideally by wrapping the result
  * in a UniquePtr immediately after the call.
  *
- * @param type Implementation type ("select" or "poll").
+ * "io_uring" falls back to epoll when the kernel lacks io_uring, has it
+ * disabled, or is too old for IoUringEventIO.
+ *
+ * @param type Implementation type ("select", "poll", "epoll", "io_uring" or "auto").
+ * @param expected_fds Expected number of descriptors, used by "auto" (0 if unknown).
  * @return Raw pointer to the created instance, or NULL on error.
+ * @throw std::runtime_error If the implementation is not available on this platform.
  */
-IEventIO* EventFactoryIO::create(const std::string &type)
+IEventIO* EventFactoryIO::create(const std::string &type, std::size_t expected_fds)
 {
-	switch (stringToType(type)) 
+	e_Type resolved = stringToType(type);
+
+	if (resolved == AUTO)
+		resolved = pickAuto(expected_fds);
+	resolved = fallback(resolved);
+	switch (resolved)
 	{
 		case SELECT:
 			return new SelectEventIO();
 		case POLL:
 			return new PollEventIO();
+		case EPOLL:
+#if defined(__linux__)
+			return new EpollEventIO();
+#else
+			throw std::runtime_error("EventFactoryIO: epoll is not available on this platform");
+#endif
+		case IO_URING:
+#if defined(COMMON_HAS_IO_URING)
+			try
+			{
+				return new IoUringEventIO();
+			}
+			catch (const std::runtime_error &)
+			{
+				return new EpollEventIO();
+			}
+#else
+			break ;
+#endif
+		case AUTO:
+			break ;
 	}
 	return NULL;
 }
 
+/**
+ * @brief Gets the implementation create() would pick for a type.
+ *
+ * @param type Implementation type, as accepted by create().
+ * @param expected_fds Expected number of descriptors, used by "auto" (0 if unknown).
+ * @return Name of a concrete implementation.
+ * @throw std::runtime_error If the provided type is not recognized.
+ */
+std::string	EventFactoryIO::resolve(const std::string &type, std::size_t expected_fds)
+{
+	e_Type resolved = stringToType(type);
+
+	if (resolved == AUTO)
+		resolved = pickAuto(expected_fds);
+	return (typeToString(fallback(resolved)));
+}
+
+/**
+ * @brief Tells whether an implementation type wakes a single waiter for
+ * descriptors registered with E_EXCLUSIVE.
+ *
+ * Only epoll does, when the headers define EPOLLEXCLUSIVE. Kernels older
+ * than Linux 4.5 accept the flag but ignore it.
+ *
+ * @param type Implementation type, as given to create().
+ * @param expected_fds Expected descriptor count, as given to create().
+ * @return true if E_EXCLUSIVE is honoured, false if an AcceptMutex is
+ *         needed instead.
+ * @throw std::runtime_error If type is unknown.
+ */
+bool	EventFactoryIO::supportsExclusive(const std::string &type, std::size_t expected_fds)
+{
+#if defined(__linux__) && defined(EPOLLEXCLUSIVE)
+	return (resolve(type, expected_fds) == "epoll");
+#else
+	(void)type;
+	(void)expected_fds;
+	return (false);
+#endif
+}
+
+/**
+ * @brief Times every available implementation and makes "auto" use the
+ * fastest for loads of the same order.
+ *
+ * Each candidate monitors the read ends of @p fds / 2 socketpairs. Every
+ * round makes an eighth of them readable, waits without blocking and
+ * drains what was reported, so that the cost of both the registration
+ * scan and the result scan is measured. Every backend available on the
+ * platform competes, select(2) included whatever the descriptor numbers,
+ * and io_uring only when the kernel can run it.
+ *
+ * The election only holds for loads of the same order as @p fds: "auto"
+ * keeps the heuristic for expected counts more than CALIBRATION_SPREAD
+ * times larger or smaller, whose costs rank differently.
+ *
+ * Meant to run once at startup, before loops are created from other
+ * threads.
+ *
+ * @param fds Number of descriptors in the workload, like the expected load.
+ * @param rounds Number of wait() calls timed per candidate.
+ * @return Name of the elected implementation.
+ * @throw std::runtime_error If the socketpairs cannot be created.
+ */
+std::string	EventFactoryIO::calibrate(std::size_t fds, std::size_t rounds)
+{
+	std::vector<int> pairs;
+	e_Type best = POLL;
+	unsigned long bestTime = 0;
+	bool first = true;
+
+	try
+	{
+		for (std::size_t i = 0; i < (fds < 2 ? 1 : fds / 2); ++i)
+		{
+			int sv[2];
+
+			if (::socketpair(AF_UNIX, SOCK_STREAM, 0, sv) == -1)
+				throw std::runtime_error("socketpair failed: " + std::string(std::strerror(errno)));
+			pairs.push_back(sv[0]);
+			pairs.push_back(sv[1]);
+		}
+		for (int type = SELECT; type < AUTO; ++type)
+		{
+			unsigned long elapsed;
+
+#if !defined(__linux__)
+			if (type == EPOLL)
+				continue ;
+#endif
+			if (type == IO_URING && fallback(IO_URING) != IO_URING)
+				continue ;
+			elapsed = measure(static_cast<e_Type>(type), pairs, rounds);
+			if (first || elapsed < bestTime)
+			{
+				best = static_cast<e_Type>(type);
+				bestTime = elapsed;
+				first = false;
+			}
+		}
+	}
+	catch (...)
+	{
+		for (std::size_t i = 0; i < pairs.size(); ++i)
+			::close(pairs[i]);
+		throw ;
+	}
+	for (std::size_t i = 0; i < pairs.size(); ++i)
+		::close(pairs[i]);
+	__atomic_store_n(&_calibratedFds, fds < 2 ? 2 : fds, __ATOMIC_RELAXED);
+	__atomic_store_n(&_calibrated, static_cast<int>(best), __ATOMIC_RELEASE);
+	return (typeToString(best));
+}
+
 /**
  * @brief Converts a string to internal enumeration type.
  *
@@ -77,9 +239,128 @@ EventFactoryIO::e_Type EventFactoryIO::stringToType(const std::string type)
 		return (SELECT);
 	if (type == "poll")
 		return (POLL);
+	if (type == "epoll")
+		return (EPOLL);
+	if (type == "io_uring")
+		return (IO_URING);
+	if (type == "auto")
+		return (AUTO);
 	throw std::runtime_error("EventFactoryIO: unknown type");
 }
 
+/**
+ * @brief Converts an enumeration type to its string.
+ *
+ * @param type Enumeration type.
+ * @return String accepted by stringToType().
+ */
+std::string	EventFactoryIO::typeToString(e_Type type)
+{
+	switch (type)
+	{
+		case SELECT:
+			return ("select");
+		case POLL:
+			return ("poll");
+		case EPOLL:
+			return ("epoll");
+		case IO_URING:
+			return ("io_uring");
+		case AUTO:
+			break ;
+	}
+	return ("auto");
+}
+
+/**
+ * @brief Picks the implementation used for "auto".
+ *
+ * The calibrated choice wins when there is one and @p expected_fds is
+ * unknown or within CALIBRATION_SPREAD times the calibrated count, since
+ * a backend elected on a few descriptors says little about thousands
+ * and conversely. Otherwise epoll is used
+ * on Linux, as its cost does not grow with the number of idle
+ * descriptors; select(2) for tiny sets when the descriptor limit keeps
+ * every number below FD_SETSIZE, as its bitmaps span up to the highest
+ * descriptor and their single copy-in only beats the alternatives while
+ * they stay small; poll(2) everywhere else.
+ *
+ * @param expected_fds Expected number of descriptors (0 if unknown).
+ * @return Concrete enumeration type.
+ */
+EventFactoryIO::e_Type	EventFactoryIO::pickAuto(std::size_t expected_fds)
+{
+	int calibrated = __atomic_load_n(&_calibrated, __ATOMIC_ACQUIRE);
+	std::size_t limit = FdTable<int>::limit();
+
+	if (calibrated >= 0)
+	{
+		std::size_t fds = __atomic_load_n(&_calibratedFds, __ATOMIC_RELAXED);
+
+		if (expected_fds == 0 || (expected_fds <= fds * CALIBRATION_SPREAD
+				&& fds <= expected_fds * CALIBRATION_SPREAD))
+			return (static_cast<e_Type>(calibrated));
+	}
+	if (expected_fds != 0 && expected_fds <= SELECT_MAX_FDS
+		&& limit != 0 && limit <= static_cast<std::size_t>(FD_SETSIZE))
+		return (SELECT);
+#if defined(__linux__)
+	return (EPOLL);
+#else
+	return (POLL);
+#endif
+}
+
+/**
+ * @brief Replaces io_uring by epoll when the kernel cannot run it.
+ *
+ * @param type Concrete enumeration type.
+ * @return @p type, or EPOLL if it is IO_URING and io_uring is unusable.
+ */
+EventFactoryIO::e_Type	EventFactoryIO::fallback(e_Type type)
+{
+	if (type != IO_URING)
+		return (type);
+#if defined(COMMON_HAS_IO_URING)
+	if (IoUringEventIO::isSupported())
+		return (IO_URING);
+#endif
+	return (EPOLL);
+}
+
+/**
+ * @brief Times one implementation on the calibration workload.
+ *
+ * @param type Implementation to time.
+ * @param fds Socketpair descriptors, read end first in each pair.
+ * @param rounds Number of wait() calls.
+ * @return Elapsed time in microseconds.
+ */
+unsigned long	EventFactoryIO::measure(e_Type type, const std::vector<int> &fds, std::size_t rounds)
+{
+	common::core::raii::UniquePtr<IEventIO> io(create(typeToString(type)));
+	const std::size_t pairs = fds.size() / 2;
+	const std::size_t active = pairs / 8 + 1;
+	std::size_t next = 0;
+	unsigned long start;
+	char byte = 0;
+
+	for (std::size_t i = 0; i < pairs; ++i)
+		io->add(fds[2 * i], IEventIO::E_IN);
+	start = utils::monotonicMicro();
+	for (std::size_t round = 0; round < rounds; ++round)
+	{
+		for (std::size_t i = 0; i < active; ++i, next = (next + 1) % pairs)
+			if (::write(fds[2 * next + 1], &byte, 1) == -1)
+				throw std::runtime_error("write failed: " + std::string(std::strerror(errno)));
+		io->wait(0);
+		for (IEventIO::ReadyList::const_iterator it = io->getReady().begin(); it != io->getReady().end(); ++it)
+			if (::read(it->fd, &byte, 1) == -1)
+				throw std::runtime_error("read failed: " + std::string(std::strerror(errno)));
+	}
+	return (utils::monotonicMicro() - start);
+}
+
 } // !io
 } // !core
 } // !common
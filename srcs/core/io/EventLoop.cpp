@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   EventLoop.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/EventLoop.hpp>
+#include <string>
+
+/**
+ * @file EventLoop.cpp
+ * @brief Implementation of the runtime-selected reactor.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @brief Constructor. Creates the backend through EventFactoryIO and
+ * registers the wakeup channel on it.
+ *
+ * @param type Backend type accepted by EventFactoryIO::create().
+ * @throw std::runtime_error If the backend or the channel cannot be created.
+ */
+EventLoop::EventLoop(const std::string &type) : BasicEventLoop<DynamicEventIO>(type) {}
+
+/**
+ * @brief Destructor. The backend is released with its adapter.
+ */
+EventLoop::~EventLoop() {}
+
+/**
+ * @brief Gets the backend used by the loop.
+ *
+ * @return Backend reference, behind the adapter.
+ */
+IEventIO	&EventLoop::getEventIO()
+{
+	return (BasicEventLoop<DynamicEventIO>::getEventIO().get());
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,285 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   EventLoopGroup.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/EventLoopGroup.hpp>
+#include <cstddef>
+#include <cstring>
+#include <pthread.h>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+#if defined(__linux__)
+# include <sched.h>
+#endif
+
+/**
+ * @file EventLoopGroup.cpp
+ * @brief Implementation of the multi-reactor runtime.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @brief Constructor. Creates the loops; no thread is started yet.
+ *
+ * @param type Backend type of every loop, see EventFactoryIO::create().
+ * @param count Number of loops, 0 for one per available CPU.
+ * @param pin Whether to bind each loop thread to its own CPU.
+ * @throw std::runtime_error If a loop cannot be created.
+ */
+EventLoopGroup::EventLoopGroup(const std::string &type, std::size_t count, bool pin) : _workers(), _next(0), _pin(pin), _running(false)
+{
+	if (count == 0)
+		count = cpuCount();
+	_workers.reserve(count);
+	try
+	{
+		for (std::size_t i = 0; i < count; ++i)
+			_workers.push_back(new Worker(this, type, _pin ? cpuFor(i) : -1));
+	}
+	catch (...)
+	{
+		for (std::size_t i = 0; i < _workers.size(); ++i)
+			delete _workers[i];
+		throw ;
+	}
+}
+
+/**
+ * @brief Constructor. Creates the loop of a worker.
+ *
+ * @param owner Group the worker belongs to.
+ * @param type Backend type of the loop.
+ * @param init_cpu CPU to pin the thread to, -1 for none.
+ */
+EventLoopGroup::Worker::Worker(EventLoopGroup *owner, const std::string &type, int init_cpu) : group(owner), loop(type), thread(), cpu(init_cpu), started(false) {}
+
+/**
+ * @brief Destructor. Stops the threads and destroys the loops.
+ */
+EventLoopGroup::~EventLoopGroup()
+{
+	stop();
+	for (std::size_t i = 0; i < _workers.size(); ++i)
+		delete _workers[i];
+}
+
+/**
+ * @brief Starts one thread per loop.
+ *
+ * @throw std::runtime_error If the group is running or a thread cannot be created.
+ */
+void	EventLoopGroup::start()
+{
+	if (isRunning())
+		throw std::runtime_error("EventLoopGroup: already running");
+	__atomic_store_n(&_running, true, __ATOMIC_RELEASE);
+	for (std::size_t i = 0; i < _workers.size(); ++i)
+	{
+		int rc = ::pthread_create(&_workers[i]->thread, NULL, &EventLoopGroup::threadMain, _workers[i]);
+
+		if (rc != 0)
+		{
+			stop();
+			throw std::runtime_error("pthread_create failed: " + std::string(std::strerror(rc)));
+		}
+		_workers[i]->started = true;
+	}
+}
+
+/**
+ * @brief Stops the loops and joins their threads. Does nothing if the
+ * group is not running; must not be called from a loop thread.
+ */
+void	EventLoopGroup::stop()
+{
+	__atomic_store_n(&_running, false, __ATOMIC_RELEASE);
+	for (std::size_t i = 0; i < _workers.size(); ++i)
+		_workers[i]->loop.wakeup();
+	for (std::size_t i = 0; i < _workers.size(); ++i)
+	{
+		if (_workers[i]->started)
+		{
+			::pthread_join(_workers[i]->thread, NULL);
+			_workers[i]->started = false;
+		}
+	}
+}
+
+/**
+ * @brief Tells whether the threads are running.
+ *
+ * @return true between start() and stop().
+ */
+bool	EventLoopGroup::isRunning() const
+{
+	return (__atomic_load_n(&_running, __ATOMIC_ACQUIRE));
+}
+
+/**
+ * @brief Gets the number of loops.
+ *
+ * @return Number of loops.
+ */
+std::size_t	EventLoopGroup::size() const
+{
+	return (_workers.size());
+}
+
+/**
+ * @brief Gets a loop of the group.
+ *
+ * @param index Loop index, lower than size().
+ * @return Loop reference.
+ * @throw std::out_of_range If index is out of range.
+ */
+EventLoop	&EventLoopGroup::getLoop(std::size_t index)
+{
+	if (index >= _workers.size())
+		throw std::out_of_range("EventLoopGroup: loop index out of range");
+	return (_workers[index]->loop);
+}
+
+/**
+ * @brief Gets the CPU a loop thread is pinned to.
+ *
+ * @param index Loop index, lower than size().
+ * @return CPU number, or -1 if the thread is not pinned.
+ * @throw std::out_of_range If index is out of range.
+ */
+int	EventLoopGroup::getCpu(std::size_t index) const
+{
+	if (index >= _workers.size())
+		throw std::out_of_range("EventLoopGroup: loop index out of range");
+	return (_workers[index]->cpu);
+}
+
+/**
+ * @brief Picks loops in turn, to spread work handed over by other
+ * threads. Safe from any thread.
+ *
+ * @return Next loop reference.
+ */
+EventLoop	&EventLoopGroup::next()
+{
+	std::size_t index = __atomic_fetch_add(&_next, 1, __ATOMIC_RELAXED);
+
+	return (_workers[index % _workers.size()]->loop);
+}
+
+/**
+ * @brief Gets the number of CPUs the process may run on.
+ *
+ * @return CPU count, at least 1.
+ */
+std::size_t	EventLoopGroup::cpuCount()
+{
+	long count;
+
+#if defined(__linux__)
+	cpu_set_t set;
+
+	if (::sched_getaffinity(0, sizeof(set), &set) == 0)
+		return (CPU_COUNT(&set) > 0 ? CPU_COUNT(&set) : 1);
+#endif
+	count = ::sysconf(_SC_NPROCESSORS_ONLN);
+	return (count > 0 ? static_cast<std::size_t>(count) : 1);
+}
+
+/**
+ * @brief Thread body: pins itself, then runs its loop until stop().
+ *
+ * @param arg Worker of the thread.
+ * @return NULL.
+ */
+void	*EventLoopGroup::threadMain(void *arg)
+{
+	Worker *worker = static_cast<Worker *>(arg);
+
+#if defined(__linux__)
+	if (worker->cpu >= 0)
+	{
+		cpu_set_t set;
+
+		CPU_ZERO(&set);
+		CPU_SET(worker->cpu, &set);
+		::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+	}
+#endif
+	while (worker->group->isRunning())
+		worker->loop.runOnce(-1);
+	return (NULL);
+}
+
+/**
+ * @brief Picks the CPU of a loop among the CPUs the process may use.
+ *
+ * @param index Loop index.
+ * @return CPU number, or -1 if pinning is not supported.
+ */
+int	EventLoopGroup::cpuFor(std::size_t index)
+{
+#if defined(__linux__)
+	cpu_set_t set;
+	std::size_t count;
+
+	if (::sched_getaffinity(0, sizeof(set), &set) != 0 || CPU_COUNT(&set) <= 0)
+		return (-1);
+	count = index % static_cast<std::size_t>(CPU_COUNT(&set));
+	for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+	{
+		if (CPU_ISSET(cpu, &set) && count-- == 0)
+			return (cpu);
+	}
+	return (-1);
+#else
+	(void)index;
+	return (-1);
+#endif
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
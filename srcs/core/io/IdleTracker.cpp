@@ -0,0 +1,324 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IdleTracker.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/IdleTracker.hpp>
+#include <cstddef>
+
+/**
+ * @file IdleTracker.cpp
+ * @brief Implementation of the idle-timeout manager.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @brief Constructor. Creates an untracked entry.
+ *
+ * @param handler Handler called on eviction, not owned (may be NULL).
+ */
+IdleEntry::IdleEntry(IIdleHandler *handler) : _handler(handler), _tracker(NULL), _prev(NULL), _next(NULL), _lastActive(0) {}
+
+/**
+ * @brief Destructor. Untracks the entry if it is tracked.
+ */
+IdleEntry::~IdleEntry()
+{
+	if (_tracker)
+		_tracker->remove(*this);
+}
+
+/**
+ * @brief Sets the handler called on eviction.
+ *
+ * @param handler Handler, not owned (may be NULL).
+ */
+void	IdleEntry::setHandler(IIdleHandler *handler)
+{
+	_handler = handler;
+}
+
+/**
+ * @brief Gets the handler called on eviction.
+ *
+ * @return Handler, NULL if none.
+ */
+IIdleHandler	*IdleEntry::getHandler() const
+{
+	return (_handler);
+}
+
+/**
+ * @brief Tells whether the entry is tracked.
+ *
+ * @return true until the entry is evicted or removed.
+ */
+bool	IdleEntry::isTracked() const
+{
+	return (_tracker != NULL);
+}
+
+/**
+ * @brief Gets the time of the last add() or touch().
+ *
+ * @return Time in the base of the tracker's wheel, meaningful while tracked.
+ */
+unsigned long	IdleEntry::getLastActive() const
+{
+	return (_lastActive);
+}
+
+/**
+ * @brief Constructor.
+ *
+ * @param timers Wheel driving the eviction timer, usually EventLoop::getTimers().
+ * @param timeout_ms Idle time after which an entry is evicted, 0 counts as 1.
+ */
+IdleTracker::IdleTracker(TimerWheel &timers, unsigned long timeout_ms)
+	: _timers(timers), _timer(this), _head(NULL), _tail(NULL), _timeout(timeout_ms ? timeout_ms : 1), _size(0) {}
+
+/**
+ * @brief Destructor. Untracks the remaining entries without evicting them.
+ */
+IdleTracker::~IdleTracker()
+{
+	clear();
+}
+
+/**
+ * @brief Starts tracking an entry, stamped as active now.
+ *
+ * An entry already tracked here is touched; one tracked by another
+ * tracker is moved.
+ *
+ * @param entry Entry to track.
+ */
+void	IdleTracker::add(IdleEntry &entry)
+{
+	if (entry._tracker == this)
+	{
+		touch(entry);
+		return ;
+	}
+	if (entry._tracker)
+		entry._tracker->remove(entry);
+	entry._tracker = this;
+	entry._lastActive = _timers.getTime();
+	link(entry);
+	if (++_size == 1)
+		arm();
+}
+
+/**
+ * @brief Stamps an entry as active now and moves it to the head.
+ *
+ * Does nothing if the entry is not tracked here. The eviction timer is
+ * left alone: it is rescheduled when it fires.
+ *
+ * @param entry Entry to touch.
+ */
+void	IdleTracker::touch(IdleEntry &entry)
+{
+	if (entry._tracker != this)
+		return ;
+	entry._lastActive = _timers.getTime();
+	if (_head == &entry)
+		return ;
+	unlink(entry);
+	link(entry);
+}
+
+/**
+ * @brief Stops tracking an entry. Does nothing if it is not tracked here.
+ *
+ * @param entry Entry to remove.
+ */
+void	IdleTracker::remove(IdleEntry &entry)
+{
+	if (entry._tracker != this)
+		return ;
+	unlink(entry);
+	entry._tracker = NULL;
+	if (--_size == 0)
+		_timers.cancel(_timer);
+}
+
+/**
+ * @brief Evicts the entries idle for the timeout, then re-arms the timer
+ * for the new tail.
+ *
+ * Each entry is untracked before its handler runs; the handler may add
+ * it back, remove or destroy other entries, but not destroy the tracker.
+ *
+ * @param timer Eviction timer.
+ */
+void	IdleTracker::onTimeout(Timer &timer)
+{
+	const unsigned long now = _timers.getTime();
+
+	(void)timer;
+	while (_tail && now - _tail->_lastActive >= _timeout)
+	{
+		IdleEntry &entry = *_tail;
+
+		unlink(entry);
+		entry._tracker = NULL;
+		--_size;
+		if (entry._handler)
+			entry._handler->onIdle(entry);
+	}
+	arm();
+}
+
+/**
+ * @brief Changes the idle timeout, effective for every tracked entry.
+ *
+ * @param timeout_ms Idle time after which an entry is evicted, 0 counts as 1.
+ */
+void	IdleTracker::setTimeout(unsigned long timeout_ms)
+{
+	_timeout = timeout_ms ? timeout_ms : 1;
+	arm();
+}
+
+/**
+ * @brief Gets the idle timeout.
+ *
+ * @return Timeout in milliseconds.
+ */
+unsigned long	IdleTracker::getTimeout() const
+{
+	return (_timeout);
+}
+
+/**
+ * @brief Gets the number of tracked entries.
+ *
+ * @return Number of entries.
+ */
+std::size_t	IdleTracker::size() const
+{
+	return (_size);
+}
+
+/**
+ * @brief Tells whether no entry is tracked.
+ *
+ * @return true if empty.
+ */
+bool	IdleTracker::empty() const
+{
+	return (_size == 0);
+}
+
+/**
+ * @brief Untracks every entry without calling the handlers.
+ */
+void	IdleTracker::clear()
+{
+	while (_head)
+	{
+		IdleEntry &entry = *_head;
+
+		unlink(entry);
+		entry._tracker = NULL;
+	}
+	_size = 0;
+	_timers.cancel(_timer);
+}
+
+/**
+ * @brief Links an entry at the head of the list.
+ *
+ * @param entry Entry to link.
+ */
+void	IdleTracker::link(IdleEntry &entry)
+{
+	entry._prev = NULL;
+	entry._next = _head;
+	if (_head)
+		_head->_prev = &entry;
+	else
+		_tail = &entry;
+	_head = &entry;
+}
+
+/**
+ * @brief Unlinks an entry from the list.
+ *
+ * @param entry Entry to unlink.
+ */
+void	IdleTracker::unlink(IdleEntry &entry)
+{
+	if (entry._prev)
+		entry._prev->_next = entry._next;
+	else
+		_head = entry._next;
+	if (entry._next)
+		entry._next->_prev = entry._prev;
+	else
+		_tail = entry._prev;
+	entry._prev = NULL;
+	entry._next = NULL;
+}
+
+/**
+ * @brief Schedules the eviction timer for the deadline of the tail, or
+ * cancels it when the list is empty.
+ */
+void	IdleTracker::arm()
+{
+	unsigned long idle;
+
+	if (_tail == NULL)
+	{
+		_timers.cancel(_timer);
+		return ;
+	}
+	idle = _timers.getTime() - _tail->_lastActive;
+	_timers.schedule(_timer, idle >= _timeout ? 0 : _timeout - idle);
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   InstrumentedHandler.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/InstrumentedHandler.hpp>
+#include <common/core/utils/timeUtils.hpp>
+
+/**
+ * @file InstrumentedHandler.cpp
+ * @brief Implementation of the timing handler decorator.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @brief Constructor.
+ *
+ * @param handler Handler receiving the forwarded callbacks, not owned.
+ */
+InstrumentedHandler::InstrumentedHandler(IEventHandler &handler) : _handler(handler), _latency() {}
+
+/**
+ * @brief Destructor.
+ */
+InstrumentedHandler::~InstrumentedHandler() {}
+
+/**
+ * @brief Forwards a read event and records its duration.
+ *
+ * @param fd Ready descriptor.
+ */
+void	InstrumentedHandler::onRead(int fd)
+{
+	unsigned long start = utils::monotonicNano();
+
+	_handler.onRead(fd);
+	_latency.record(utils::monotonicNano() - start);
+}
+
+/**
+ * @brief Forwards a write event and records its duration.
+ *
+ * @param fd Ready descriptor.
+ */
+void	InstrumentedHandler::onWrite(int fd)
+{
+	unsigned long start = utils::monotonicNano();
+
+	_handler.onWrite(fd);
+	_latency.record(utils::monotonicNano() - start);
+}
+
+/**
+ * @brief Forwards an error event and records its duration.
+ *
+ * @param fd Ready descriptor.
+ */
+void	InstrumentedHandler::onError(int fd)
+{
+	unsigned long start = utils::monotonicNano();
+
+	_handler.onError(fd);
+	_latency.record(utils::monotonicNano() - start);
+}
+
+/**
+ * @brief Gets the callback latencies. Safe from any thread.
+ *
+ * @return Histogram of the callback durations, in nanoseconds.
+ */
+utils::Histogram::Snapshot	InstrumentedHandler::getLatency() const
+{
+	return (_latency.snapshot());
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,343 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IoUring.cpp                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/IoUring.hpp>
+
+/**
+ * @file IoUring.cpp
+ * @brief Implementation of the raw io_uring(7) ring.
+ */
+
+#if defined(COMMON_HAS_IO_URING)
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+const unsigned	IoUring::DEFAULT_ENTRIES;
+
+/**
+ * @brief Constructor. Creates the ring and maps it.
+ *
+ * The kernel rounds @p entries up to a power of two; the completion ring
+ * gets twice as many entries.
+ *
+ * @param entries Requested number of submission entries.
+ * @param flags IORING_SETUP_* flags.
+ * @param sq_idle_ms Idle time before the IORING_SETUP_SQPOLL thread sleeps.
+ * @throw std::runtime_error If io_uring_setup(2) or mmap(2) fails, or if
+ *        the kernel cannot map both rings at once.
+ */
+IoUring::IoUring(unsigned entries, unsigned flags, unsigned sq_idle_ms)
+	: _fd(), _ring(MAP_FAILED), _ringSize(0), _sqes(static_cast<struct io_uring_sqe *>(MAP_FAILED)), _sqesSize(0),
+	_features(0), _flags(flags), _sqHead(NULL), _sqTail(NULL), _sqFlags(NULL), _sqArray(NULL), _sqMask(0), _sqEntries(0), _sqLocalTail(0),
+	_cqHead(NULL), _cqTail(NULL), _cqes(NULL), _cqMask(0), _syscalls(0)
+{
+	struct io_uring_params params;
+	char *ring;
+
+	std::memset(&params, 0, sizeof(params));
+	params.flags = flags;
+	params.sq_thread_idle = sq_idle_ms;
+	_fd.reset(static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params)));
+	if (_fd.valid() == false)
+		throw std::runtime_error("io_uring_setup failed: " + std::string(std::strerror(errno)));
+	if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0)
+		throw std::runtime_error("io_uring_setup failed: rings cannot be mapped at once");
+	_features = params.features;
+	_ringSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	if (params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe) > _ringSize)
+		_ringSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	_sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	_ring = ::mmap(NULL, _ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd.get(), IORING_OFF_SQ_RING);
+	if (_ring != MAP_FAILED)
+		_sqes = static_cast<struct io_uring_sqe *>(::mmap(NULL, _sqesSize, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, _fd.get(), IORING_OFF_SQES));
+	if (_ring == MAP_FAILED || _sqes == MAP_FAILED)
+	{
+		int err = errno;
+
+		unmap();
+		throw std::runtime_error("mmap failed: " + std::string(std::strerror(err)));
+	}
+	ring = static_cast<char *>(_ring);
+	_sqHead = reinterpret_cast<unsigned *>(ring + params.sq_off.head);
+	_sqTail = reinterpret_cast<unsigned *>(ring + params.sq_off.tail);
+	_sqFlags = reinterpret_cast<unsigned *>(ring + params.sq_off.flags);
+	_sqArray = reinterpret_cast<unsigned *>(ring + params.sq_off.array);
+	_sqMask = *reinterpret_cast<unsigned *>(ring + params.sq_off.ring_mask);
+	_sqEntries = *reinterpret_cast<unsigned *>(ring + params.sq_off.ring_entries);
+	_sqLocalTail = *_sqTail;
+	_cqHead = reinterpret_cast<unsigned *>(ring + params.cq_off.head);
+	_cqTail = reinterpret_cast<unsigned *>(ring + params.cq_off.tail);
+	_cqes = reinterpret_cast<struct io_uring_cqe *>(ring + params.cq_off.cqes);
+	_cqMask = *reinterpret_cast<unsigned *>(ring + params.cq_off.ring_mask);
+	for (unsigned i = 0; i < _sqEntries; ++i)
+		_sqArray[i] = i;
+}
+
+/**
+ * @brief Destructor. Unmaps the rings; closing the descriptor cancels
+ *        the requests still in flight.
+ */
+IoUring::~IoUring()
+{
+	unmap();
+}
+
+/**
+ * @brief Gets a blank submission entry.
+ *
+ * The entry is queued but not seen by the kernel until the next submit().
+ * When the submission ring is full, the queued entries are submitted
+ * first to make room.
+ *
+ * @return Zeroed submission entry, or NULL if the kernel did not consume
+ *         any queued entry.
+ * @throw std::runtime_error If io_uring_enter(2) fails.
+ */
+struct io_uring_sqe	*IoUring::getSqe()
+{
+	struct io_uring_sqe *sqe;
+
+	if (pending() >= _sqEntries)
+	{
+		submit();
+		if (pending() >= _sqEntries)
+			return (NULL);
+	}
+	sqe = &_sqes[_sqLocalTail & _sqMask];
+	std::memset(sqe, 0, sizeof(*sqe));
+	++_sqLocalTail;
+	return (sqe);
+}
+
+/**
+ * @brief Submits the queued entries without waiting for completions.
+ *
+ * @return Number of entries consumed by the kernel.
+ * @throw std::runtime_error If io_uring_enter(2) fails.
+ */
+unsigned	IoUring::submit()
+{
+	unsigned count = pending();
+
+	if (count == 0)
+		return (0);
+	if (_flags & IORING_SETUP_SQPOLL)
+	{
+		__atomic_store_n(_sqTail, _sqLocalTail, __ATOMIC_RELEASE);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		if (__atomic_load_n(_sqFlags, __ATOMIC_RELAXED) & IORING_SQ_NEED_WAKEUP)
+			enter(0, 0, 0, IORING_ENTER_SQ_WAKEUP);
+		return (count);
+	}
+	return (enter(count, 0, 0, 0));
+}
+
+/**
+ * @brief Submits the queued entries and waits for completions, in one call.
+ *
+ * Expiry of the timeout is not an error: the completion ring is simply
+ * left with fewer than @p wait_nr entries. Without anything to submit,
+ * wait or flush from an overflown completion ring, no call is made.
+ *
+ * @param wait_nr Number of completions to wait for (0 to only reap).
+ * @param timeout_ms Timeout in milliseconds (-1 for infinite).
+ * @return Number of entries consumed by the kernel.
+ * @throw std::runtime_error If io_uring_enter(2) fails.
+ */
+unsigned	IoUring::submitAndWait(unsigned wait_nr, int timeout_ms)
+{
+	unsigned count = pending();
+
+	if (timeout_ms == 0)
+		wait_nr = 0;
+	if (count == 0 && wait_nr == 0
+		&& (__atomic_load_n(_sqFlags, __ATOMIC_RELAXED) & IORING_SQ_CQ_OVERFLOW) == 0)
+		return (0);
+	if (_flags & IORING_SETUP_SQPOLL)
+	{
+		submit();
+		if (wait_nr == 0 && (__atomic_load_n(_sqFlags, __ATOMIC_RELAXED) & IORING_SQ_CQ_OVERFLOW) == 0)
+			return (count);
+		enter(0, wait_nr, timeout_ms, IORING_ENTER_GETEVENTS);
+		return (count);
+	}
+	return (enter(count, wait_nr, timeout_ms, IORING_ENTER_GETEVENTS));
+}
+
+/**
+ * @brief Registers buffers or files with the ring (io_uring_register(2)).
+ *
+ * @param opcode IORING_REGISTER_* operation.
+ * @param arg Operation argument.
+ * @param nr Number of elements in @p arg.
+ * @throw std::runtime_error If io_uring_register(2) fails.
+ */
+void	IoUring::registerResource(unsigned opcode, const void *arg, unsigned nr)
+{
+	__atomic_store_n(&_syscalls, _syscalls + 1, __ATOMIC_RELAXED);
+	if (::syscall(__NR_io_uring_register, _fd.get(), opcode, arg, nr) == -1)
+		throw std::runtime_error("io_uring_register failed: " + std::string(std::strerror(errno)));
+}
+
+/**
+ * @brief Gets the number of submission entries the kernel has not consumed.
+ *
+ * @return Number of queued entries.
+ */
+unsigned	IoUring::pending() const
+{
+	return (_sqLocalTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE));
+}
+
+/**
+ * @brief Gets the ring descriptor.
+ *
+ * @return io_uring file descriptor.
+ */
+int	IoUring::getFd() const
+{
+	return (_fd.get());
+}
+
+/**
+ * @brief Gets the IORING_FEAT_* flags reported by the kernel.
+ *
+ * @return Feature mask.
+ */
+unsigned	IoUring::getFeatures() const
+{
+	return (_features);
+}
+
+/**
+ * @brief Gets the size of the submission ring.
+ *
+ * @return Number of submission entries.
+ */
+unsigned	IoUring::getEntries() const
+{
+	return (_sqEntries);
+}
+
+/**
+ * @brief Gets the number of io_uring_enter(2) and io_uring_register(2) calls.
+ *
+ * @return Syscall count since construction. Safe from any thread.
+ */
+unsigned long	IoUring::getSyscalls() const
+{
+	return (__atomic_load_n(&_syscalls, __ATOMIC_RELAXED));
+}
+
+/**
+ * @brief Publishes the queued entries and calls io_uring_enter(2).
+ *
+ * The timeout is passed through IORING_ENTER_EXT_ARG when the kernel
+ * supports it; without it, waits are only bounded by completions.
+ *
+ * @param to_submit Number of queued entries to submit.
+ * @param wait_nr Number of completions to wait for.
+ * @param timeout_ms Timeout in milliseconds (-1 for infinite).
+ * @param flags IORING_ENTER_* flags.
+ * @return Number of entries consumed by the kernel.
+ * @throw std::runtime_error If io_uring_enter(2) fails for another reason
+ *        than an expired timeout or a busy completion ring.
+ */
+unsigned	IoUring::enter(unsigned to_submit, unsigned wait_nr, int timeout_ms, unsigned flags)
+{
+	struct io_uring_getevents_arg arg;
+	struct __kernel_timespec ts;
+	void *argp = NULL;
+	std::size_t argsz = 0;
+	long ret;
+
+	__atomic_store_n(_sqTail, _sqLocalTail, __ATOMIC_RELEASE);
+	if (wait_nr != 0 && timeout_ms > 0 && (_features & IORING_FEAT_EXT_ARG))
+	{
+		std::memset(&arg, 0, sizeof(arg));
+		ts.tv_sec = timeout_ms / 1000;
+		ts.tv_nsec = static_cast<long long>(timeout_ms % 1000) * 1000000;
+		arg.ts = reinterpret_cast<unsigned long>(&ts);
+		flags |= IORING_ENTER_EXT_ARG;
+		argp = &arg;
+		argsz = sizeof(arg);
+	}
+	__atomic_store_n(&_syscalls, _syscalls + 1, __ATOMIC_RELAXED);
+	ret = ::syscall(__NR_io_uring_enter, _fd.get(), to_submit, wait_nr, flags, argp, argsz);
+	if (ret == -1)
+	{
+		if (errno == ETIME || errno == EBUSY || errno == EAGAIN)
+			return (0);
+		throw std::runtime_error("io_uring_enter failed: " + std::string(std::strerror(errno)));
+	}
+	return (static_cast<unsigned>(ret));
+}
+
+/**
+ * @brief Unmaps whatever the constructor managed to map.
+ */
+void	IoUring::unmap()
+{
+	if (_sqes != MAP_FAILED)
+		::munmap(_sqes, _sqesSize);
+	if (_ring != MAP_FAILED)
+		::munmap(_ring, _ringSize);
+	_sqes = static_cast<struct io_uring_sqe *>(MAP_FAILED);
+	_ring = MAP_FAILED;
+}
+
+} // !io
+} // !core
+} // !common
+
+#endif // COMMON_HAS_IO_URING
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
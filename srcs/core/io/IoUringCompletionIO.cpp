@@ -0,0 +1,484 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IoUringCompletionIO.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/IoUringCompletionIO.hpp>
+
+/**
+ * @file IoUringCompletionIO.cpp
+ * @brief Implementation of the io_uring(7) completion engine.
+ */
+
+#if defined(COMMON_HAS_IO_URING)
+
+#include <cstring>
+#include <stdexcept>
+#include <stdint.h>
+#include <sys/socket.h>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+const unsigned	IoUringCompletionIO::SQPOLL_IDLE_MS;
+const char		IoUringCompletionIO::_internal = 0;
+
+/// Value written to a registered file slot to empty it.
+static const int	g_noFile = -1;
+
+/**
+ * @brief Constructor. Creates the ring.
+ *
+ * @param entries Requested number of submission entries.
+ * @param sqpoll Let a kernel thread poll the submission ring.
+ * @throw std::runtime_error If the ring cannot be created.
+ */
+IoUringCompletionIO::IoUringCompletionIO(unsigned entries, bool sqpoll)
+	: _ring(entries, sqpoll ? IORING_SETUP_SQPOLL : 0, sqpoll ? SQPOLL_IDLE_MS : 0),
+	_completed(), _buffers(), _slots(), _freeSlots(), _closingSlots(), _inflight(0) {}
+
+/**
+ * @brief Destructor. Closing the ring cancels the operations in flight.
+ */
+IoUringCompletionIO::~IoUringCompletionIO() {}
+
+/**
+ * @brief Queues the acceptance of a connection.
+ *
+ * The completion result is the new descriptor, non-blocking and
+ * close-on-exec. A multishot accept keeps accepting, with one completion
+ * per connection, until a completion arrives without Completion::more.
+ *
+ * @param fd Listening socket.
+ * @param token Token returned with the completions.
+ * @param multishot Keep the request armed (Linux 5.19).
+ * @throw std::runtime_error If the submission ring stays full.
+ */
+void	IoUringCompletionIO::accept(int fd, void *token, bool multishot)
+{
+	struct io_uring_sqe *sqe = prepare(IORING_OP_ACCEPT, fd, token);
+
+	sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+	if (multishot)
+		sqe->ioprio |= IORING_ACCEPT_MULTISHOT;
+}
+
+/**
+ * @brief Queues a recv(2).
+ *
+ * @param fd Connected socket.
+ * @param buf Buffer receiving the data.
+ * @param len Size of @p buf.
+ * @param token Token returned with the completion.
+ * @throw std::runtime_error If the submission ring stays full.
+ */
+void	IoUringCompletionIO::recv(int fd, void *buf, std::size_t len, void *token)
+{
+	struct io_uring_sqe *sqe = prepare(IORING_OP_RECV, fd, token);
+
+	sqe->addr = reinterpret_cast<uintptr_t>(buf);
+	sqe->len = static_cast<uint32_t>(len);
+}
+
+/**
+ * @brief Queues a send(2), without SIGPIPE.
+ *
+ * @param fd Connected socket.
+ * @param buf Data to send.
+ * @param len Size of @p buf.
+ * @param token Token returned with the completion.
+ * @throw std::runtime_error If the submission ring stays full.
+ */
+void	IoUringCompletionIO::send(int fd, const void *buf, std::size_t len, void *token)
+{
+	struct io_uring_sqe *sqe = prepare(IORING_OP_SEND, fd, token);
+
+	sqe->addr = reinterpret_cast<uintptr_t>(buf);
+	sqe->len = static_cast<uint32_t>(len);
+	sqe->msg_flags = MSG_NOSIGNAL;
+}
+
+/**
+ * @brief Queues a readv(2).
+ *
+ * @param fd Descriptor to read from, at its current position.
+ * @param iov Buffers to fill.
+ * @param iovcnt Number of buffers.
+ * @param token Token returned with the completion.
+ * @throw std::runtime_error If the submission ring stays full.
+ */
+void	IoUringCompletionIO::readv(int fd, const struct iovec *iov, int iovcnt, void *token)
+{
+	struct io_uring_sqe *sqe = prepare(IORING_OP_READV, fd, token);
+
+	sqe->addr = reinterpret_cast<uintptr_t>(iov);
+	sqe->len = static_cast<uint32_t>(iovcnt);
+	sqe->off = static_cast<uint64_t>(-1);
+}
+
+/**
+ * @brief Queues a writev(2).
+ *
+ * @param fd Descriptor to write to, at its current position.
+ * @param iov Buffers to send.
+ * @param iovcnt Number of buffers.
+ * @param token Token returned with the completion.
+ * @throw std::runtime_error If the submission ring stays full.
+ */
+void	IoUringCompletionIO::writev(int fd, const struct iovec *iov, int iovcnt, void *token)
+{
+	struct io_uring_sqe *sqe = prepare(IORING_OP_WRITEV, fd, token);
+
+	sqe->addr = reinterpret_cast<uintptr_t>(iov);
+	sqe->len = static_cast<uint32_t>(iovcnt);
+	sqe->off = static_cast<uint64_t>(-1);
+}
+
+/**
+ * @brief Queues a read into a registered buffer.
+ *
+ * @param fd Descriptor to read from, at its current position.
+ * @param buf_index Index of the buffer given to registerBuffers().
+ * @param offset Offset in the buffer.
+ * @param len Number of bytes to read at most.
+ * @param token Token returned with the completion.
+ * @throw std::out_of_range If the range is outside the registered buffer.
+ * @throw std::runtime_error If the submission ring stays full.
+ */
+void	IoUringCompletionIO::readFixed(int fd, unsigned buf_index, std::size_t offset, std::size_t len, void *token)
+{
+	struct io_uring_sqe *sqe;
+
+	if (buf_index >= _buffers.size() || offset > _buffers[buf_index].iov_len
+		|| len > _buffers[buf_index].iov_len - offset)
+		throw std::out_of_range("IoUringCompletionIO: range outside registered buffer");
+	sqe = prepare(IORING_OP_READ_FIXED, fd, token);
+	sqe->addr = reinterpret_cast<uintptr_t>(_buffers[buf_index].iov_base) + offset;
+	sqe->len = static_cast<uint32_t>(len);
+	sqe->off = static_cast<uint64_t>(-1);
+	sqe->buf_index = static_cast<uint16_t>(buf_index);
+}
+
+/**
+ * @brief Queues a write from a registered buffer.
+ *
+ * @param fd Descriptor to write to, at its current position.
+ * @param buf_index Index of the buffer given to registerBuffers().
+ * @param offset Offset in the buffer.
+ * @param len Number of bytes to write.
+ * @param token Token returned with the completion.
+ * @throw std::out_of_range If the range is outside the registered buffer.
+ * @throw std::runtime_error If the submission ring stays full.
+ */
+void	IoUringCompletionIO::writeFixed(int fd, unsigned buf_index, std::size_t offset, std::size_t len, void *token)
+{
+	struct io_uring_sqe *sqe;
+
+	if (buf_index >= _buffers.size() || offset > _buffers[buf_index].iov_len
+		|| len > _buffers[buf_index].iov_len - offset)
+		throw std::out_of_range("IoUringCompletionIO: range outside registered buffer");
+	sqe = prepare(IORING_OP_WRITE_FIXED, fd, token);
+	sqe->addr = reinterpret_cast<uintptr_t>(_buffers[buf_index].iov_base) + offset;
+	sqe->len = static_cast<uint32_t>(len);
+	sqe->off = static_cast<uint64_t>(-1);
+	sqe->buf_index = static_cast<uint16_t>(buf_index);
+}
+
+/**
+ * @brief Queues a close(2).
+ *
+ * A registered descriptor also has its slot emptied by an
+ * IORING_OP_FILES_UPDATE submitted just before. The two requests are not
+ * linked: a failed update would otherwise cancel the close and leak the
+ * descriptor. The file is released when both have completed, and the
+ * slot is reused once the update has been submitted.
+ *
+ * @param fd Descriptor to close.
+ * @param token Token returned with the completion.
+ * @throw std::runtime_error If the submission ring stays full.
+ */
+void	IoUringCompletionIO::close(int fd, void *token)
+{
+	if (const unsigned *slot = _slots.find(fd))
+	{
+		struct io_uring_sqe *sqe = _ring.getSqe();
+
+		if (sqe == NULL)
+			throw std::runtime_error("io_uring_enter failed: submission queue full");
+		sqe->opcode = IORING_OP_FILES_UPDATE;
+		sqe->fd = -1;
+		sqe->addr = reinterpret_cast<uintptr_t>(&g_noFile);
+		sqe->len = 1;
+		sqe->off = *slot;
+		sqe->user_data = reinterpret_cast<uintptr_t>(&_internal);
+		_closingSlots.push_back(*slot);
+		_slots.erase(fd);
+	}
+	prepare(IORING_OP_CLOSE, fd, token);
+}
+
+/**
+ * @brief Registers buffers for readFixed() and writeFixed().
+ *
+ * The pages are pinned once instead of on every operation. The buffers
+ * belong to the caller and must outlive the engine.
+ *
+ * @param iov Buffers to register, indexed from 0.
+ * @param count Number of buffers.
+ * @throw std::runtime_error If io_uring_register(2) fails.
+ */
+void	IoUringCompletionIO::registerBuffers(const struct iovec *iov, unsigned count)
+{
+	_ring.registerResource(IORING_REGISTER_BUFFERS, iov, count);
+	_buffers.assign(iov, iov + count);
+}
+
+/**
+ * @brief Creates the registered file table, with every slot empty.
+ *
+ * @param slots Number of descriptors that can be registered at once.
+ * @throw std::runtime_error If io_uring_register(2) fails.
+ */
+void	IoUringCompletionIO::registerFiles(unsigned slots)
+{
+	std::vector<int> fds(slots, -1);
+
+	_ring.registerResource(IORING_REGISTER_FILES, &fds[0], slots);
+	_freeSlots.clear();
+	for (unsigned slot = slots; slot > 0; --slot)
+		_freeSlots.push_back(slot - 1);
+}
+
+/**
+ * @brief Puts a descriptor in a free slot of the registered file table.
+ *
+ * The following operations on @p fd use the slot. Registering a
+ * descriptor twice does nothing.
+ *
+ * @param fd Descriptor to register.
+ * @throw std::runtime_error If no slot is free or io_uring_register(2) fails.
+ */
+void	IoUringCompletionIO::registerFd(int fd)
+{
+	if (_slots.contains(fd))
+		return ;
+	if (_freeSlots.empty())
+		throw std::runtime_error("io_uring_register failed: no free file slot");
+	updateSlot(_freeSlots.back(), fd);
+	_slots.insert(fd, _freeSlots.back());
+	_freeSlots.pop_back();
+}
+
+/**
+ * @brief Empties the slot of a registered descriptor.
+ *
+ * Operations already queued keep using the slot; call this once they
+ * have completed.
+ *
+ * @param fd Registered descriptor.
+ * @throw std::runtime_error If io_uring_register(2) fails.
+ */
+void	IoUringCompletionIO::unregisterFd(int fd)
+{
+	const unsigned *slot = _slots.find(fd);
+
+	if (slot == NULL)
+		return ;
+	updateSlot(*slot, -1);
+	_freeSlots.push_back(*slot);
+	_slots.erase(fd);
+}
+
+/**
+ * @brief Submits the queued operations without waiting.
+ *
+ * @throw std::runtime_error If io_uring_enter(2) fails.
+ */
+void	IoUringCompletionIO::submit()
+{
+	_ring.submit();
+	submitted();
+}
+
+/**
+ * @brief Submits the queued operations and reaps completions.
+ *
+ * Blocks only while operations are in flight, so that an idle engine
+ * never hangs its caller.
+ *
+ * @param timeout_ms Timeout in milliseconds (-1 for infinite, 0 for non-blocking).
+ * @return Number of completions in getCompleted().
+ * @throw std::runtime_error If io_uring_enter(2) fails.
+ */
+int		IoUringCompletionIO::wait(int timeout_ms)
+{
+	_completed.clear();
+	_ring.submitAndWait(_inflight ? 1 : 0, _inflight ? timeout_ms : 0);
+	submitted();
+	processResults();
+	return (static_cast<int>(_completed.size()));
+}
+
+/**
+ * @brief Gets the completions reaped by the last wait().
+ *
+ * @return Completion list, valid until the next wait().
+ */
+const IoUringCompletionIO::CompletionList	&IoUringCompletionIO::getCompleted() const
+{
+	return (_completed);
+}
+
+/**
+ * @brief Gets the number of operations whose final completion is pending.
+ *
+ * @return Number of operations in flight.
+ */
+std::size_t	IoUringCompletionIO::getInflight() const
+{
+	return (_inflight);
+}
+
+/**
+ * @brief Gets the ring descriptor, readable while completions are pending.
+ *
+ * @return io_uring file descriptor.
+ */
+int		IoUringCompletionIO::getFd() const
+{
+	return (_ring.getFd());
+}
+
+/**
+ * @brief Gets the number of system calls made on the ring.
+ *
+ * @return Syscall count since construction. Safe from any thread.
+ */
+unsigned long	IoUringCompletionIO::getSyscalls() const
+{
+	return (_ring.getSyscalls());
+}
+
+/**
+ * @brief Gets a submission entry for an operation on a descriptor.
+ *
+ * @param opcode IORING_OP_* operation.
+ * @param fd Descriptor, replaced by its slot if registered.
+ * @param token Token returned with the completion.
+ * @return Submission entry to complete.
+ * @throw std::runtime_error If the submission ring stays full.
+ */
+struct io_uring_sqe	*IoUringCompletionIO::prepare(int opcode, int fd, void *token)
+{
+	struct io_uring_sqe *sqe = _ring.getSqe();
+
+	if (sqe == NULL)
+		throw std::runtime_error("io_uring_enter failed: submission queue full");
+	sqe->opcode = static_cast<uint8_t>(opcode);
+	if (const unsigned *slot = _slots.find(fd))
+	{
+		sqe->fd = static_cast<int>(*slot);
+		sqe->flags = IOSQE_FIXED_FILE;
+	}
+	else
+		sqe->fd = fd;
+	sqe->user_data = reinterpret_cast<uintptr_t>(token);
+	++_inflight;
+	return (sqe);
+}
+
+/**
+ * @brief Sets a slot of the registered file table.
+ *
+ * @param slot Slot index.
+ * @param fd Descriptor to store, -1 to empty the slot.
+ * @throw std::runtime_error If io_uring_register(2) fails.
+ */
+void	IoUringCompletionIO::updateSlot(unsigned slot, int fd)
+{
+	struct io_uring_files_update update;
+
+	std::memset(&update, 0, sizeof(update));
+	update.offset = slot;
+	update.fds = reinterpret_cast<uintptr_t>(&fd);
+	_ring.registerResource(IORING_REGISTER_FILES_UPDATE, &update, 1);
+}
+
+/**
+ * @brief Frees the slots of closed descriptors once the kernel consumed
+ *        the requests emptying them.
+ */
+void	IoUringCompletionIO::submitted()
+{
+	if (_closingSlots.empty() || _ring.pending() != 0)
+		return ;
+	_freeSlots.insert(_freeSlots.end(), _closingSlots.begin(), _closingSlots.end());
+	_closingSlots.clear();
+}
+
+/**
+ * @brief Moves the completions found in the ring to the completion list.
+ */
+void	IoUringCompletionIO::processResults()
+{
+	struct io_uring_cqe *cqe;
+
+	while ((cqe = _ring.peekCqe()) != NULL)
+	{
+		Completion completion;
+
+		completion.token = reinterpret_cast<void *>(static_cast<uintptr_t>(cqe->user_data));
+		completion.result = cqe->res;
+		completion.more = (cqe->flags & IORING_CQE_F_MORE) != 0;
+		_ring.advanceCq();
+		if (completion.token == &_internal)
+			continue ;
+		if (completion.more == false)
+			--_inflight;
+		_completed.push_back(completion);
+	}
+}
+
+} // !io
+} // !core
+} // !common
+
+#endif // COMMON_HAS_IO_URING
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,530 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   IoUringEventIO.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/IEventIO.hpp>
+#include <common/core/io/IoUringEventIO.hpp>
+#include <common/core/utils/timeUtils.hpp>
+
+/**
+ * @file IoUringEventIO.cpp
+ * @brief Implementation of io_uring(7)-based I/O event handler.
+ */
+
+#if defined(COMMON_HAS_IO_URING)
+
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <poll.h>
+#include <stdexcept>
+#include <string>
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+const uint64_t	IoUringEventIO::CANCEL_TAG;
+int				IoUringEventIO::_supported = -1;
+
+/**
+ * @brief Builds the user_data of a poll request from its descriptor and tag.
+ */
+static uint64_t	userData(int fd, uint32_t generation)
+{
+	return ((static_cast<uint64_t>(generation) << 32) | static_cast<uint32_t>(fd));
+}
+
+/**
+ * @brief Default constructor. Creates the ring.
+ *
+ * @throw std::runtime_error If io_uring is unavailable, disabled, or the
+ *        kernel lacks multishot poll or IORING_ENTER_EXT_ARG.
+ */
+IoUringEventIO::IoUringEventIO() : _ring(new IoUring()), _events(), _ready(), _changes(), _generation(0), _syscalls(0), _pastSyscalls(0)
+{
+	unsigned needed = IORING_FEAT_EXT_ARG | IORING_FEAT_NODROP | IORING_FEAT_RSRC_TAGS;
+
+	if ((_ring->getFeatures() & needed) != needed)
+		throw std::runtime_error("io_uring_setup failed: kernel too old for multishot poll");
+}
+
+/**
+ * @brief Constructor. Creates an entry with no interest and no event.
+ */
+IoUringEventIO::Entry::Entry()
+	: events(E_NONE), ready(E_NONE), kernel(E_NONE), data(NULL), slot(0), generation(0),
+	active(false), inflight(false), queued(false) {}
+
+/**
+ * @brief Destructor. Closing the ring cancels every poll request.
+ */
+IoUringEventIO::~IoUringEventIO() {}
+
+/**
+ * @brief Waits for events on monitored file descriptors.
+ *
+ * The changelist, the re-arming of the level-triggered descriptors
+ * reported last time and the wait itself go through a single
+ * io_uring_enter(2).
+ *
+ * The ring also returns completions that are not events: those of the
+ * cancellations this backend submits and the late ones of replaced poll
+ * requests. When only those arrive, the wait resumes for the rest of the
+ * timeout, so that 0 is only returned once it has expired.
+ *
+ * @param timeout_ms Timeout in milliseconds (-1 for infinite, 0 for non-blocking).
+ * @return Number of entries in the ready list, or 0 on timeout.
+ * @throw std::runtime_error If io_uring_enter fails.
+ */
+int	IoUringEventIO::wait(int timeout_ms)
+{
+	unsigned long start = 0;
+	int remaining;
+
+	for (ReadyList::const_iterator it = _ready.begin(); it != _ready.end(); ++it)
+		if (Entry *entry = _events.find(it->fd))
+			entry->ready = E_NONE;
+	_ready.clear();
+	prepare();
+	if (_events.empty())
+	{
+		_ring->submit();
+		countSyscalls();
+		processResults();
+		return (static_cast<int>(_ready.size()));
+	}
+	if (_ready.empty() == false)
+		timeout_ms = 0;
+	if (timeout_ms > 0)
+		start = utils::monotonicMilli();
+	remaining = timeout_ms;
+	for (;;)
+	{
+		_ring->submitAndWait(1, remaining);
+		countSyscalls();
+		processResults();
+		if (_ready.empty() == false || remaining == 0)
+			break ;
+		if (remaining > 0)
+		{
+			unsigned long elapsed = utils::monotonicMilli() - start;
+
+			if (elapsed >= static_cast<unsigned long>(timeout_ms))
+				break ;
+			remaining = timeout_ms - static_cast<int>(elapsed);
+		}
+		prepare();
+	}
+	return (static_cast<int>(_ready.size()));
+}
+
+/**
+ * @brief Adds a file descriptor to monitor for events.
+ *
+ * Adding an already monitored descriptor replaces its event mask and
+ * user pointer. The poll request is always re-armed, in case the
+ * descriptor number now refers to a new file.
+ *
+ * @param fd File descriptor to add.
+ * @param mask Event mask to monitor (E_IN, E_OUT, E_EXCEPT, E_EDGE, E_ONESHOT).
+ * @param data User pointer returned with the descriptor's ready events.
+ * @throw std::out_of_range If fd is negative.
+ */
+void IoUringEventIO::add(int fd, e_Event mask, void *data)
+{
+	Entry *entry = _events.find(fd);
+
+	if (entry == NULL)
+		entry = &_events.insert(fd, Entry());
+	entry->events = mask;
+	entry->kernel = E_NONE;
+	entry->data = data;
+	entry->active = true;
+	queue(fd, *entry);
+}
+
+/**
+ * @brief Removes a file descriptor from monitoring.
+ *
+ * A pending entry in the ready list is kept but reported as E_NONE, so
+ * that a caller iterating getReady() can remove descriptors safely.
+ *
+ * @param fd File descriptor to remove.
+ */
+void IoUringEventIO::remove(int fd)
+{
+	Entry *entry = _events.find(fd);
+
+	if (entry == NULL || entry->active == false)
+		return ;
+	if (entry->ready != E_NONE)
+		_ready[entry->slot].events = E_NONE;
+	entry->active = false;
+	entry->ready = E_NONE;
+	entry->data = NULL;
+	if (entry->inflight)
+		queue(fd, *entry);
+	else if (entry->queued == false)
+		_events.erase(fd);
+}
+
+/**
+ * @brief Updates the event mask for a monitored file descriptor.
+ *
+ * Keeps the user pointer. Queues a change only when the mask differs from
+ * the one of the poll request in flight, which includes re-arming an
+ * E_ONESHOT descriptor that fired.
+ *
+ * @param fd File descriptor to update.
+ * @param mask New event mask.
+ */
+void IoUringEventIO::update(int fd, e_Event mask)
+{
+	Entry *entry = _events.find(fd);
+
+	if (entry == NULL || entry->active == false)
+		return ;
+	entry->events = mask;
+	if (entry->inflight == false || entry->kernel != mask)
+		queue(fd, *entry);
+}
+
+/**
+ * @brief Updates the event mask and user pointer for a monitored file descriptor.
+ *
+ * The user pointer is kept on the user side, so only a mask change
+ * reaches the kernel.
+ *
+ * @param fd File descriptor to update.
+ * @param mask New event mask.
+ * @param data New user pointer.
+ */
+void IoUringEventIO::update(int fd, e_Event mask, void *data)
+{
+	Entry *entry = _events.find(fd);
+
+	if (entry == NULL || entry->active == false)
+		return ;
+	entry->data = data;
+	update(fd, mask);
+}
+
+/**
+ * @brief Applies the changelist with one io_uring_enter(2).
+ *
+ * Rejected requests are reported by the next wait() as E_EXCEPT events.
+ *
+ * @throw std::runtime_error If io_uring_enter fails.
+ */
+void IoUringEventIO::flush()
+{
+	prepare();
+	_ring->submit();
+	countSyscalls();
+}
+
+/**
+ * @brief Removes all monitored file descriptors.
+ *
+ * The ring is recreated, which cancels every poll request at once.
+ *
+ * @throw std::runtime_error If the new ring cannot be created.
+ */
+void IoUringEventIO::clear()
+{
+	IoUring *ring = new IoUring();
+
+	_pastSyscalls += _ring->getSyscalls();
+	_ring.reset(ring);
+	_events.clear();
+	_ready.clear();
+	_changes.clear();
+}
+
+/**
+ * @brief Gets the detected events for a file descriptor.
+ *
+ * @param fd File descriptor to query.
+ * @return Detected event mask (E_NONE if fd not monitored).
+ */
+IEventIO::e_Event IoUringEventIO::getEvents(int fd) const
+{
+	const Entry *entry = _events.find(fd);
+	if (entry == NULL || entry->active == false)
+		return (E_NONE);
+	return (entry->ready);
+}
+
+/**
+ * @brief Tells whether this kernel can run the backend.
+ *
+ * The probe creates a ring once; the answer is cached for the process.
+ *
+ * @return true if the constructor would succeed.
+ */
+bool	IoUringEventIO::isSupported()
+{
+	int supported = __atomic_load_n(&_supported, __ATOMIC_ACQUIRE);
+
+	if (supported < 0)
+	{
+		try
+		{
+			IoUringEventIO probe;
+
+			supported = 1;
+		}
+		catch (const std::runtime_error &)
+		{
+			supported = 0;
+		}
+		__atomic_store_n(&_supported, supported, __ATOMIC_RELEASE);
+	}
+	return (supported == 1);
+}
+
+/**
+ * @brief Puts a descriptor in the changelist, once.
+ *
+ * @param fd File descriptor concerned.
+ * @param entry Entry of the descriptor.
+ */
+void IoUringEventIO::queue(int fd, Entry &entry)
+{
+	if (entry.queued)
+		return ;
+	entry.queued = true;
+	_changes.push_back(fd);
+}
+
+/**
+ * @brief Turns the changelist into submission entries, without submitting them.
+ */
+void IoUringEventIO::prepare()
+{
+	for (std::vector<int>::const_iterator it = _changes.begin(); it != _changes.end(); ++it)
+	{
+		Entry *entry = _events.find(*it);
+
+		if (entry == NULL || entry->queued == false)
+			continue ;
+		entry->queued = false;
+		apply(*it, *entry);
+	}
+	_changes.clear();
+}
+
+/**
+ * @brief Brings the poll request of a descriptor to its wanted state.
+ *
+ * A request whose mask is still the wanted one is left alone. Otherwise
+ * it is cancelled and a new one is armed under a new generation, so
+ * that late completions of the old request are recognised and ignored.
+ *
+ * @param fd File descriptor concerned.
+ * @param entry Entry of the descriptor.
+ */
+void IoUringEventIO::apply(int fd, Entry &entry)
+{
+	if (entry.active == false)
+	{
+		if (entry.inflight)
+			cancel(fd, entry);
+		_events.erase(fd);
+		return ;
+	}
+	if (entry.inflight && entry.kernel == entry.events)
+		return ;
+	if (entry.inflight)
+		cancel(fd, entry);
+	entry.kernel = entry.events;
+	if (entry.events & (E_IN | E_OUT | E_EXCEPT))
+		arm(fd, entry);
+}
+
+/**
+ * @brief Queues the poll request of a descriptor.
+ *
+ * E_EDGE without E_ONESHOT uses a multishot request, which stays armed
+ * and posts a completion per wakeup; anything else is single-shot.
+ *
+ * @param fd File descriptor concerned.
+ * @param entry Entry of the descriptor.
+ */
+void IoUringEventIO::arm(int fd, Entry &entry)
+{
+	struct io_uring_sqe *sqe = getSqe();
+	uint32_t mask = eventToMask(entry.events);
+
+	entry.generation = ++_generation;
+	sqe->opcode = IORING_OP_POLL_ADD;
+	sqe->fd = fd;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	mask = (mask << 16) | (mask >> 16);
+#endif
+	sqe->poll32_events = mask;
+	if ((entry.events & E_EDGE) && !(entry.events & E_ONESHOT))
+		sqe->len = IORING_POLL_ADD_MULTI;
+	sqe->user_data = userData(fd, entry.generation);
+	entry.inflight = true;
+}
+
+/**
+ * @brief Queues the cancellation of the poll request of a descriptor.
+ *
+ * @param fd File descriptor concerned.
+ * @param entry Entry of the descriptor.
+ */
+void IoUringEventIO::cancel(int fd, Entry &entry)
+{
+	struct io_uring_sqe *sqe = getSqe();
+
+	sqe->opcode = IORING_OP_POLL_REMOVE;
+	sqe->fd = -1;
+	sqe->addr = userData(fd, entry.generation);
+	sqe->user_data = CANCEL_TAG;
+	entry.inflight = false;
+}
+
+/**
+ * @brief Gets a submission entry from the ring.
+ *
+ * @return Blank submission entry.
+ * @throw std::runtime_error If the submission ring stays full.
+ */
+struct io_uring_sqe	*IoUringEventIO::getSqe()
+{
+	struct io_uring_sqe *sqe = _ring->getSqe();
+
+	if (sqe == NULL)
+		throw std::runtime_error("io_uring_enter failed: submission queue full");
+	return (sqe);
+}
+
+/**
+ * @brief Appends the completions found in the ring to the ready list.
+ *
+ * Completions of cancellations and of replaced requests are skipped.
+ * A request that ended is re-armed by the next wait(), unless its
+ * descriptor is E_ONESHOT; one that failed drops its descriptor, which
+ * is reported as E_EXCEPT.
+ */
+void IoUringEventIO::processResults()
+{
+	struct io_uring_cqe *cqe;
+
+	while ((cqe = _ring->peekCqe()) != NULL)
+	{
+		uint64_t data = cqe->user_data;
+		int res = cqe->res;
+		bool more = (cqe->flags & IORING_CQE_F_MORE) != 0;
+		int fd = static_cast<int>(data & 0xffffffffULL);
+		Entry *entry;
+
+		_ring->advanceCq();
+		if (data == CANCEL_TAG || (entry = _events.find(fd)) == NULL || entry->active == false
+			|| entry->inflight == false || entry->generation != static_cast<uint32_t>(data >> 32))
+			continue ;
+		if (more == false)
+			entry->inflight = false;
+		if (res < 0)
+		{
+			report(fd, *entry, E_EXCEPT);
+			if (entry->inflight)
+				cancel(fd, *entry);
+			entry->active = false;
+			if (entry->queued == false)
+				_events.erase(fd);
+			continue ;
+		}
+		if (e_Event mask = maskToEvent(static_cast<uint32_t>(res)))
+			report(fd, *entry, mask);
+		if (entry->inflight == false)
+		{
+			entry->kernel = (entry->kernel & E_ONESHOT) ? disarm(entry->kernel, entry->kernel) : E_NONE;
+			if (entry->kernel == E_NONE)
+				queue(fd, *entry);
+		}
+	}
+}
+
+/**
+ * @brief Records events for a descriptor, merging multishot completions.
+ *
+ * @param fd File descriptor concerned.
+ * @param entry Entry of the descriptor.
+ * @param mask Reported directions.
+ */
+void IoUringEventIO::report(int fd, Entry &entry, e_Event mask)
+{
+	ReadyEvent ev;
+
+	if (entry.ready != E_NONE)
+	{
+		entry.ready = static_cast<e_Event>(entry.ready | mask);
+		_ready[entry.slot].events = entry.ready;
+		return ;
+	}
+	ev.fd = fd;
+	ev.events = mask;
+	ev.data = entry.data;
+	entry.ready = mask;
+	entry.slot = _ready.size();
+	_ready.push_back(ev);
+}
+
+/**
+ * @brief Publishes the syscall count of the rings for getSyscalls().
+ *
+ * The ring may be replaced by clear(), so other threads only ever read
+ * this copy.
+ */
+void IoUringEventIO::countSyscalls()
+{
+	__atomic_store_n(&_syscalls, _pastSyscalls + _ring->getSyscalls(), __ATOMIC_RELAXED);
+}
+
+} // !io
+} // !core
+} // !common
+
+#endif // COMMON_HAS_IO_URING
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,464 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   OutputQueue.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/AEventLoop.hpp>
+#include <common/core/io/OutputQueue.hpp>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+/**
+ * @file OutputQueue.cpp
+ * @brief Implementation of the per-connection output queue.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+#if defined(MSG_NOSIGNAL)
+static const int	SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int	SEND_FLAGS = 0;
+#endif
+
+const std::size_t	OutputQueue::MAX_IOV;
+const std::size_t	OutputQueue::COMPACT_SEGMENTS;
+const std::size_t	OutputQueue::COMPACT_BYTES;
+
+/**
+ * @brief Constructor. Creates an empty, detached queue.
+ *
+ * @param fd Socket the queue writes to.
+ * @param handler Handler told about incomplete deferred flushes, not
+ *        owned (may be NULL).
+ */
+OutputQueue::OutputQueue(int fd, IOutputHandler *handler)
+	: _fd(fd), _handler(handler), _loop(NULL), _prev(NULL), _next(NULL), _deferred(false), _blocked(false), _cork(false),
+	_buffer(), _segments(), _first(0), _size(0) {}
+
+/**
+ * @brief Destructor. Detaches the queue, dropping what it still holds.
+ */
+OutputQueue::~OutputQueue()
+{
+	detach();
+}
+
+/**
+ * @brief Attaches the queue to a loop, which flushes it at the end of
+ * the iterations in which data was appended.
+ *
+ * @param loop Loop flushing the queue, on whose thread the queue is used.
+ */
+void	OutputQueue::attach(AEventLoop &loop)
+{
+	detach();
+	_loop = &loop;
+	if (_size)
+		defer();
+}
+
+/**
+ * @brief Detaches the queue from its loop. The queue is then only
+ * flushed by flush().
+ */
+void	OutputQueue::detach()
+{
+	if (_loop)
+		_loop->undefer(*this);
+	_loop = NULL;
+}
+
+/**
+ * @brief Queues a copy of data.
+ *
+ * The copy goes at the end of the owned buffer and extends the previous
+ * fragment when it was copied too, so small writes cost one iovec.
+ *
+ * @param data Bytes to send.
+ * @param len Number of bytes, 0 does nothing.
+ */
+void	OutputQueue::append(const void *data, std::size_t len)
+{
+	const char *bytes = static_cast<const char *>(data);
+
+	if (len == 0)
+		return ;
+	if (_first < _segments.size() && _segments.back().ref == NULL
+		&& _segments.back().offset + _segments.back().len == _buffer.size())
+		_segments.back().len += len;
+	else
+	{
+		Segment segment = {NULL, _buffer.size(), len};
+
+		_segments.push_back(segment);
+	}
+	_buffer.insert(_buffer.end(), bytes, bytes + len);
+	_size += len;
+	defer();
+}
+
+/**
+ * @brief Queues data without copying it.
+ *
+ * @param data Bytes to send, which must stay valid and unchanged until
+ *        the queue is drained or cleared.
+ * @param len Number of bytes, 0 does nothing.
+ */
+void	OutputQueue::appendRef(const void *data, std::size_t len)
+{
+	Segment segment = {static_cast<const char *>(data), 0, len};
+
+	if (len == 0)
+		return ;
+	_segments.push_back(segment);
+	_size += len;
+	defer();
+}
+
+/**
+ * @brief Sends as much of the queue as the socket takes, now.
+ *
+ * Meant for onWrite() after a blocked deferred flush, or for queues not
+ * attached to a loop. Draining the queue unblocks it; a full socket
+ * blocks it.
+ *
+ * @return true if the queue is drained, false if the socket is full.
+ * @throw std::runtime_error If sendmsg fails for another reason.
+ */
+bool	OutputQueue::flush()
+{
+	int error = send();
+
+	if (error == 0)
+	{
+		if (_loop)
+			_loop->undefer(*this);
+		_blocked = false;
+		return (true);
+	}
+	if (error == EAGAIN || error == EWOULDBLOCK)
+	{
+		_blocked = true;
+		return (false);
+	}
+	throw std::runtime_error("sendmsg failed: " + std::string(std::strerror(error)));
+}
+
+/**
+ * @brief Drops the queued data and unblocks the queue. The buffers keep
+ * their capacity.
+ */
+void	OutputQueue::clear()
+{
+	if (_loop)
+		_loop->undefer(*this);
+	_blocked = false;
+	_buffer.clear();
+	_segments.clear();
+	_first = 0;
+	_size = 0;
+}
+
+/**
+ * @brief Sets the socket the queue writes to.
+ *
+ * @param fd File descriptor.
+ */
+void	OutputQueue::setFd(int fd)
+{
+	_fd = fd;
+}
+
+/**
+ * @brief Gets the socket the queue writes to.
+ *
+ * @return File descriptor, -1 if unset.
+ */
+int	OutputQueue::getFd() const
+{
+	return (_fd);
+}
+
+/**
+ * @brief Sets the handler told about incomplete deferred flushes.
+ *
+ * @param handler Handler, not owned (may be NULL).
+ */
+void	OutputQueue::setHandler(IOutputHandler *handler)
+{
+	_handler = handler;
+}
+
+/**
+ * @brief Gets the handler told about incomplete deferred flushes.
+ *
+ * @return Handler, NULL if none.
+ */
+IOutputHandler	*OutputQueue::getHandler() const
+{
+	return (_handler);
+}
+
+/**
+ * @brief Enables or disables corking of flushes that need more than one
+ * sendmsg(2).
+ *
+ * @param enabled true to bracket such flushes with TCP_CORK.
+ */
+void	OutputQueue::setCork(bool enabled)
+{
+	_cork = enabled;
+}
+
+/**
+ * @brief Tells whether long flushes are corked.
+ *
+ * @return true if enabled.
+ */
+bool	OutputQueue::getCork() const
+{
+	return (_cork);
+}
+
+/**
+ * @brief Tells whether the queue waits for the flush of its loop.
+ *
+ * @return true from the first append() of an iteration until the flush.
+ */
+bool	OutputQueue::isDeferred() const
+{
+	return (_deferred);
+}
+
+/**
+ * @brief Tells whether the socket was full at the last flush.
+ *
+ * @return true from an incomplete flush until a flush() drains the queue.
+ */
+bool	OutputQueue::isBlocked() const
+{
+	return (_blocked);
+}
+
+/**
+ * @brief Gets the number of bytes waiting to be sent.
+ *
+ * @return Queued bytes.
+ */
+std::size_t	OutputQueue::size() const
+{
+	return (_size);
+}
+
+/**
+ * @brief Tells whether the queue is drained.
+ *
+ * @return true if no byte is queued.
+ */
+bool	OutputQueue::empty() const
+{
+	return (_size == 0);
+}
+
+/**
+ * @brief Writes the queued fragments with sendmsg(2), MAX_IOV at a time.
+ *
+ * Retries on EINTR and stops at the first other error, keeping the
+ * fragments not sent. Corks the socket first when enabled and the
+ * fragments do not fit one call.
+ *
+ * @return 0 once drained, EAGAIN or EWOULDBLOCK if the socket is full,
+ *         the errno of sendmsg otherwise.
+ */
+int	OutputQueue::send()
+{
+	const bool corked = _cork && _segments.size() - _first > MAX_IOV;
+	int error = 0;
+
+	if (corked)
+		cork(true);
+	while (_first < _segments.size())
+	{
+		struct iovec iov[MAX_IOV];
+		struct msghdr msg;
+		std::size_t n = 0;
+		ssize_t sent;
+
+		for (std::size_t i = _first; i < _segments.size() && n < MAX_IOV; ++i, ++n)
+		{
+			const Segment &segment = _segments[i];
+
+			iov[n].iov_base = const_cast<char *>(segment.ref ? segment.ref : &_buffer[segment.offset]);
+			iov[n].iov_len = segment.len;
+		}
+		std::memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = iov;
+		msg.msg_iovlen = n;
+		sent = ::sendmsg(_fd, &msg, SEND_FLAGS);
+		if (sent == -1)
+		{
+			if (errno == EINTR)
+				continue ;
+			error = errno;
+			break ;
+		}
+		consume(static_cast<std::size_t>(sent));
+	}
+	if (corked)
+		cork(false);
+	return (error);
+}
+
+/**
+ * @brief Drops the first n queued bytes, resetting the buffers once the
+ * queue is drained and compacting them otherwise.
+ *
+ * @param n Bytes sent.
+ */
+void	OutputQueue::consume(std::size_t n)
+{
+	_size -= n;
+	while (n && _first < _segments.size())
+	{
+		Segment &segment = _segments[_first];
+
+		if (n < segment.len)
+		{
+			if (segment.ref)
+				segment.ref += n;
+			else
+				segment.offset += n;
+			segment.len -= n;
+			break ;
+		}
+		n -= segment.len;
+		++_first;
+	}
+	if (_first == _segments.size())
+	{
+		_buffer.clear();
+		_segments.clear();
+		_first = 0;
+	}
+	else
+		compact();
+}
+
+/**
+ * @brief Drops the sent segments and the sent prefix of the owned
+ * buffer, rebasing the offsets, so that a queue that never drains does
+ * not grow without bound.
+ *
+ * Each part is moved only once the dead prefix is at least as large as
+ * what is left, so the copies cost no more than the bytes appended.
+ */
+void	OutputQueue::compact()
+{
+	std::size_t dead = _buffer.size();
+
+	if (_first >= COMPACT_SEGMENTS && _first * 2 >= _segments.size())
+	{
+		_segments.erase(_segments.begin(), _segments.begin() + _first);
+		_first = 0;
+	}
+	if (dead < COMPACT_BYTES)
+		return ;
+	for (std::size_t i = _first; i < _segments.size(); ++i)
+	{
+		if (_segments[i].ref == NULL)
+		{
+			dead = _segments[i].offset;
+			break ;
+		}
+	}
+	if (dead < COMPACT_BYTES || dead * 2 < _buffer.size())
+		return ;
+	_buffer.erase(_buffer.begin(), _buffer.begin() + dead);
+	for (std::size_t i = _first; i < _segments.size(); ++i)
+	{
+		if (_segments[i].ref == NULL)
+			_segments[i].offset -= dead;
+	}
+}
+
+/**
+ * @brief Sets TCP_CORK (TCP_NOPUSH on the BSDs) on the socket.
+ *
+ * Failures are ignored: corking only groups segments, and the option is
+ * refused by sockets other than TCP.
+ *
+ * @param enabled true to hold partial segments, false to push them.
+ */
+void	OutputQueue::cork(bool enabled)
+{
+	int value = enabled ? 1 : 0;
+
+#if defined(TCP_CORK)
+	::setsockopt(_fd, IPPROTO_TCP, TCP_CORK, &value, sizeof(value));
+#elif defined(TCP_NOPUSH)
+	::setsockopt(_fd, IPPROTO_TCP, TCP_NOPUSH, &value, sizeof(value));
+#else
+	(void)value;
+#endif
+}
+
+/**
+ * @brief Asks the attached loop, if any, to flush the queue at the end
+ * of the iteration. A blocked queue waits for flush() instead.
+ */
+void	OutputQueue::defer()
+{
+	if (_loop && _blocked == false)
+		_loop->defer(*this);
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
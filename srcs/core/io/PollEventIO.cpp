@@ -12,11 +12,19 @@
 
 #include <common/core/io/IEventIO.hpp>
 #include <common/core/io/PollEventIO.hpp>
+#include <cstddef>
 #include <cstring>
 #include <cerrno>
 #include <stdexcept>
 #include <poll.h>
 
+#if defined(__GNUC__) && defined(__x86_64__)
+# define COMMON_POLL_SIMD 1
+# include <immintrin.h>
+#else
+# define COMMON_POLL_SIMD 0
+#endif
+
 /**
  * @file PollEventIO.cpp
  * @brief Implementation of poll(2)-based I/O event handler.
@@ -29,10 +37,94 @@ namespace core
 namespace io
 {
 
+/// Finds the first pollfd with non-zero revents in [from, count), or count.
+typedef std::size_t	(*ScanFn)(const struct pollfd *fds, std::size_t from, std::size_t count);
+
+/**
+ * @brief Scalar revents scan, one pollfd at a time.
+ */
+static std::size_t	scanScalar(const struct pollfd *fds, std::size_t from, std::size_t count)
+{
+	while (from < count && fds[from].revents == 0)
+		++from;
+	return (from);
+}
+
+#if COMMON_POLL_SIMD
+
+/**
+ * @brief SSE2 revents scan, two pollfds per compare.
+ *
+ * A pollfd is 8 bytes with revents in bytes 6-7: comparing 16-bit lanes
+ * against zero and keeping the byte mask bits of those lanes flags the
+ * pollfds with events.
+ */
+static std::size_t	scanSse2(const struct pollfd *fds, std::size_t from, std::size_t count)
+{
+	const __m128i zero = _mm_setzero_si128();
+
+	for (; from + 2 <= count; from += 2)
+	{
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(fds + from));
+		unsigned m = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi16(v, zero))) & 0xC0C0U;
+
+		if (m)
+			return (from + __builtin_ctz(m) / 8);
+	}
+	return (scanScalar(fds, from, count));
+}
+
+/**
+ * @brief AVX2 revents scan, eight pollfds per iteration.
+ *
+ * Same lane test as scanSse2() on two 32-byte loads, whose masks are
+ * merged into one 64-bit word.
+ */
+__attribute__((target("avx2")))
+static std::size_t	scanAvx2(const struct pollfd *fds, std::size_t from, std::size_t count)
+{
+	const __m256i zero = _mm256_setzero_si256();
+
+	for (; from + 8 <= count; from += 8)
+	{
+		__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(fds + from));
+		__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(fds + from + 4));
+		unsigned long long m = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(a, zero)))
+			| static_cast<unsigned long long>(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(b, zero)))) << 32;
+
+		m = ~m & 0xC0C0C0C0C0C0C0C0ULL;
+		if (m)
+			return (from + __builtin_ctzll(m) / 8);
+	}
+	return (scanSse2(fds, from, count));
+}
+
+#endif
+
+/**
+ * @brief Picks the widest revents scan the CPU supports.
+ *
+ * The vector scans assume the Linux and BSD pollfd layout and fall back
+ * to the scalar scan for any other.
+ */
+static ScanFn	pickScan()
+{
+#if COMMON_POLL_SIMD
+	if (sizeof(struct pollfd) == 8 && offsetof(struct pollfd, revents) == 6)
+	{
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+			return (&scanAvx2);
+		return (&scanSse2);
+	}
+#endif
+	return (&scanScalar);
+}
+
 /**
  * @brief Default constructor. Initializes empty poll structures.
  */
-PollEventIO::PollEventIO() : _events(), _ready(), _pollfds() {}
+PollEventIO::PollEventIO() : _pollfds(), _interests(), _index(), _ready(), _syscalls(0) {}
 
 /**
  * @brief Destructor.
@@ -42,187 +134,212 @@ PollEventIO::~PollEventIO() {}
 /**
  * @brief Waits for events on monitored file descriptors.
  *
+ * The persistent pollfd array is handed to the kernel as is.
+ *
  * @param timeout_ms Timeout in milliseconds (-1 for infinite, 0 for non-blocking).
- * @return Number of file descriptors with events, or 0 on timeout.
+ * @return Number of entries in the ready list, or 0 on timeout.
  * @throw std::runtime_error If poll fails.
  */
 int	PollEventIO::wait(int timeout_ms)
 {
 	int ready;
 
-	if (_events.empty())
+	_ready.clear();
+	if (_pollfds.empty())
 		return (0);
-	prepareWait();
+	countSyscall(_syscalls);
 	if ((ready = ::poll(&_pollfds[0], _pollfds.size(), timeout_ms)) == -1)
 		throw std::runtime_error("poll failed: " + std::string(std::strerror(errno)));
 	if (ready)
-		processResults();
-	return (ready);
+		processResults(ready);
+	return (static_cast<int>(_ready.size()));
 }
 
 /**
  * @brief Adds a file descriptor to monitor for events.
  *
+ * Appends one slot to the pollfd array. Adding an already monitored
+ * descriptor replaces its event mask and user pointer.
+ *
  * @param fd File descriptor to add.
- * @param mask Event mask to monitor (E_IN, E_OUT, E_EXCEPT).
+ * @param mask Event mask to monitor (E_IN, E_OUT, E_EXCEPT, E_EDGE, E_ONESHOT).
+ * @param data User pointer returned with the descriptor's ready events.
  */
-void PollEventIO::add(int fd, e_Event mask)
+void PollEventIO::add(int fd, e_Event mask, void *data)
 {
-	_events[fd] = mask;
+	if (fd < 0)
+		return ;
+	if (std::size_t *idx = _index.find(fd))
+	{
+		setSlot(*idx, fd, Interest(mask, data));
+		return ;
+	}
+
+	struct pollfd pfd;
+	pfd.fd = fd;
+	pfd.events = 0;
+	pfd.revents = 0;
+	_pollfds.push_back(pfd);
+	_interests.push_back(Interest());
+	setSlot(_index.insert(fd, _pollfds.size() - 1), fd, Interest(mask, data));
 }
 
 /**
  * @brief Removes a file descriptor from monitoring.
  *
+ * The last slot of the pollfd array is moved into the freed one.
+ * A pending entry in the ready list is kept but reported as E_NONE, so
+ * that a caller iterating getReady() can remove descriptors safely.
+ *
  * @param fd File descriptor to remove.
  */
 void PollEventIO::remove(int fd)
 {
-	std::map<int, e_Event>::iterator it = _events.find(fd);
-	if (it == _events.end())
+	const std::size_t *slot = _index.find(fd);
+	if (slot == NULL)
 		return ;
 
-	_events.erase(it);
-	_ready.erase(fd);
+	std::size_t idx = *slot;
+	std::size_t last = _pollfds.size() - 1;
+	if (idx != last)
+	{
+		_pollfds[idx] = _pollfds[last];
+		_interests[idx] = _interests[last];
+		_index.insert(slotFd(idx), idx);
+	}
+	_pollfds.pop_back();
+	_interests.pop_back();
+	_index.erase(fd);
+	for (ReadyList::iterator rit = _ready.begin(); rit != _ready.end(); ++rit)
+		if (rit->fd == fd)
+			rit->events = E_NONE;
 }
 
 /**
  * @brief Updates the event mask for a monitored file descriptor.
  *
+ * Patches the descriptor slot in place, keeping its user pointer. Also
+ * re-arms a descriptor disarmed by E_EDGE or E_ONESHOT.
+ *
  * @param fd File descriptor to update.
  * @param mask New event mask.
  */
 void PollEventIO::update(int fd, e_Event mask)
 {
-	std::map<int, e_Event>::iterator it = _events.find(fd);
-	if (it != _events.end())
-		it->second = mask;
+	if (std::size_t *idx = _index.find(fd))
+		setSlot(*idx, fd, Interest(mask, _interests[*idx].data));
+}
+
+/**
+ * @brief Updates the event mask and user pointer for a monitored file descriptor.
+ *
+ * @param fd File descriptor to update.
+ * @param mask New event mask.
+ * @param data New user pointer.
+ */
+void PollEventIO::update(int fd, e_Event mask, void *data)
+{
+	if (std::size_t *idx = _index.find(fd))
+		setSlot(*idx, fd, Interest(mask, data));
 }
 
+/**
+ * @brief Applies queued interest changes.
+ *
+ * Changes are applied to the pollfd array as they are made, so there is
+ * nothing to do.
+ */
+void PollEventIO::flush() {}
+
 /**
  * @brief Removes all monitored file descriptors.
  */
 void PollEventIO::clear()
 {
-	_events.clear();
-	_ready.clear();
 	_pollfds.clear();
+	_interests.clear();
+	_index.clear();
+	_ready.clear();
 }
 
 /**
  * @brief Gets the detected events for a file descriptor.
  *
+ * Reads the revents left by the last poll(2) in the descriptor slot.
+ *
  * @param fd File descriptor to query.
  * @return Detected event mask (E_NONE if fd not monitored).
  */
 IEventIO::e_Event PollEventIO::getEvents(int fd) const
 {
-	std::map<int, e_Event>::const_iterator it = _ready.find(fd);
-	if (it == _ready.end())
+	const std::size_t *idx = _index.find(fd);
+	if (idx == NULL)
 		return (E_NONE);
-	return (it->second);
-}
-
-/**
- * @brief Rebuilds the pollfd vector from the event map.
- */
-void PollEventIO::prepareWait()
-{
-	_pollfds.clear();
-
-	std::map<int, e_Event>::const_iterator it;
-	for (it = _events.begin(); it != _events.end(); ++it)
-	{
-		struct pollfd pfd;
-		pfd.fd = it->first;
-		pfd.events = eventToMask(it->second);
-		pfd.revents = 0;
-		_pollfds.push_back(pfd);
-	}
+	return (maskToEvent(_pollfds[*idx].revents));
 }
 
 /**
- * @brief Updates detected events from poll(2) results.
+ * @brief Writes a registration into a pollfd slot.
+ *
+ * A descriptor disarmed by E_EDGE or E_ONESHOT keeps its slot with a
+ * negated fd, which poll(2) ignores, instead of being moved out.
+ *
+ * @param idx Slot index in the pollfd array.
+ * @param fd File descriptor owning the slot.
+ * @param interest Event mask and user pointer to register.
  */
-void PollEventIO::processResults()
+void PollEventIO::setSlot(std::size_t idx, int fd, const Interest &interest)
 {
-	_ready.clear();
-	for (size_t i = 0; i < _pollfds.size(); ++i)
-	{
-		if (_pollfds[i].revents != 0)
-		{
-			e_Event mask = maskToEvent(_pollfds[i].revents);
-			if (mask)
-				_ready[_pollfds[i].fd] = mask;
-		}
-	}
+	_interests[idx] = interest;
+	_pollfds[idx].events = eventToMask(interest.events);
+	_pollfds[idx].fd = isDisarmed(interest.events) ? ~fd : fd;
 }
 
 /**
- * @brief Converts IEventIO event mask to poll(2) event mask.
- * 
- *     POLLIN There is data to read.
-              There is some exceptional condition on the file descriptor.
-              Possibilities include:
-
-              •  There is out-of-band data on a TCP socket (see tcp(7)).
-
-              •  A pseudoterminal master in packet mode has seen a state
-                 change on the slave (see ioctl_tty(2)).
-
-              •  A cgroup.events file has been modified (see cgroups(7)).
-
-       POLLOUT
-              Writing is now possible, though a write larger than the
-              available space in a socket or pipe will still block
-              (unless O_NONBLOCK is set).
-
-       POLLERR
-              Error condition (only returned in revents; ignored in
-              events).  This bit is also set for a file descriptor
-              referring to the write end of a pipe when the read end has
-              been closed.
-
-       POLLHUP
-              Hang up (only returned in revents; ignored in events).
-              Note that when reading from a channel such as a pipe or a
-              stream socket, this event merely indicates that the peer
-              closed its end of the channel.  Subsequent reads from the
-              channel will return 0 (end of file) only after all
-              outstanding data in the channel has been consumed.
+ * @brief Gets the file descriptor owning a pollfd slot, armed or not.
+ *
+ * @param idx Slot index in the pollfd array.
+ * @return File descriptor of the slot.
  */
-short PollEventIO::eventToMask(e_Event event) const
+int PollEventIO::slotFd(std::size_t idx) const
 {
-	short mask = 0;
-	
-	if (event & E_IN)
-		mask |= POLLIN;
-	if (event & E_OUT)
-		mask |= POLLOUT;
-	if (event & E_EXCEPT)
-		mask |= POLLERR | POLLHUP;
-	
-	return (mask);
+	int fd = _pollfds[idx].fd;
+	return (fd < 0 ? ~fd : fd);
 }
 
 /**
- * @brief Converts poll(2) event mask to IEventIO event mask.
+ * @brief Appends the descriptors with non-zero revents to the ready list.
+ *
+ * The pollfd array is searched with the widest scan the CPU supports
+ * (AVX2, SSE2 or scalar, chosen once), and the search stops once the
+ * @p ready descriptors counted by poll(2) have been seen, so sparse
+ * activity costs a few wide compares instead of a pass over every slot.
+ * Reported descriptors registered with E_EDGE or E_ONESHOT are disarmed.
  *
- * @param mask poll(2) event mask.
- * @return Corresponding IEventIO event mask.
+ * @param ready Number of pollfds with non-zero revents.
  */
-IEventIO::e_Event PollEventIO::maskToEvent(short mask) const
+void PollEventIO::processResults(int ready)
 {
-	e_Event event = E_NONE;
-	
-	if (mask & POLLIN)
-		event = static_cast<e_Event>(event | E_IN);
-	if (mask & POLLOUT)
-		event = static_cast<e_Event>(event | E_OUT);
-	if (mask & (POLLERR | POLLHUP | POLLNVAL))
-		event = static_cast<e_Event>(event | E_EXCEPT);
-	
-	return (event);
+	static const ScanFn scan = pickScan();
+	const struct pollfd *fds = &_pollfds[0];
+	const std::size_t count = _pollfds.size();
+
+	for (std::size_t i = scan(fds, 0, count); i < count && ready > 0; i = scan(fds, i + 1, count))
+	{
+		e_Event mask = maskToEvent(_pollfds[i].revents);
+
+		--ready;
+		if (mask)
+		{
+			ReadyEvent ev;
+			ev.fd = _pollfds[i].fd;
+			ev.events = mask;
+			ev.data = _interests[i].data;
+			_ready.push_back(ev);
+			if (_interests[i].events & (E_EDGE | E_ONESHOT))
+				setSlot(i, ev.fd, Interest(disarm(_interests[i].events, mask), ev.data));
+		}
+	}
 }
 
 } // !io
@@ -10,13 +10,16 @@
 /*                                                                            */
 /* ************************************************************************** */
 
+#if defined(__APPLE__) && !defined(_DARWIN_UNLIMITED_SELECT)
+# define _DARWIN_UNLIMITED_SELECT
+#endif
+
 #include "common/core/io/IEventIO.hpp"
-#include <algorithm>
 #include <common/core/io/SelectEventIO.hpp>
-#include <common/core/utils/stringUtils.hpp>
+#include <algorithm>
+#include <cstddef>
 #include <cstring>
 #include <cerrno>
-#include <map>
 #include <stdexcept>
 #include <utility>
 #include <sys/select.h>
@@ -34,19 +37,37 @@ namespace io
 {
 
 /**
- * @brief Constructor. Initializes all fd_events structures to zero.
+ * @brief Constructor. Sizes the bitmaps for FD_SETSIZE descriptors, all clear.
  */
 SelectEventIO::Sets::Sets()
+	: _readfds(words(FD_SETSIZE), 0), _writefds(words(FD_SETSIZE), 0), _exceptfds(words(FD_SETSIZE), 0) {}
+
+/**
+ * @brief Grows the bitmaps to a number of words, new words cleared.
+ *
+ * @param words Number of words per bitmap.
+ */
+void	SelectEventIO::Sets::resize(std::size_t words)
+{
+	_readfds.resize(words, 0);
+	_writefds.resize(words, 0);
+	_exceptfds.resize(words, 0);
+}
+
+/**
+ * @brief Clears every bit, keeping the bitmap sizes.
+ */
+void	SelectEventIO::Sets::zero()
 {
-	FD_ZERO(&_readfds);
-	FD_ZERO(&_writefds);
-	FD_ZERO(&_exceptfds);
+	std::fill(_readfds.begin(), _readfds.end(), 0UL);
+	std::fill(_writefds.begin(), _writefds.end(), 0UL);
+	std::fill(_exceptfds.begin(), _exceptfds.end(), 0UL);
 }
 
 /**
  * @brief Default constructor. Initializes empty event sets.
  */
-SelectEventIO::SelectEventIO() : _events(), _ready(), _nfds(0) {}
+SelectEventIO::SelectEventIO() : _events(), _ready(), _master(), _result(), _nfds(0), _resultWords(0), _syscalls(0) {}
 
 /**
  * @brief Destructor.
@@ -56,138 +77,303 @@ SelectEventIO::~SelectEventIO() {}
 /**
  * @brief Waits for events on monitored file descriptors.
  *
+ * The words of the master sets covering _nfds are copied into the
+ * result sets, which select(2) overwrites with the ready descriptors.
+ * Words past _nfds are clear in the master sets, but may still hold the
+ * report of a descriptor disarmed since the previous wait(), which
+ * lowered _nfds: those result words are cleared so that getEvents()
+ * does not return stale readiness.
+ *
  * @param timeout_ms Timeout in milliseconds (-1 for infinite, 0 for non-blocking).
- * @return Number of file descriptors with events, or 0 on timeout.
+ * @return Number of entries in the ready list, or 0 on timeout.
  * @throw std::runtime_error If select fails.
  */
 int	SelectEventIO::wait(int timeout_ms)
 {
+	const std::size_t count = words(_nfds);
+	const std::size_t used = count * sizeof(unsigned long);
 	struct timeval tv;
-	Sets sets;
 	int	ready;
 
-	prepareWait(sets);
+	_ready.clear();
+	std::memcpy(&_result._readfds[0], &_master._readfds[0], used);
+	std::memcpy(&_result._writefds[0], &_master._writefds[0], used);
+	std::memcpy(&_result._exceptfds[0], &_master._exceptfds[0], used);
+	if (_resultWords > count)
+	{
+		std::fill(_result._readfds.begin() + count, _result._readfds.begin() + _resultWords, 0UL);
+		std::fill(_result._writefds.begin() + count, _result._writefds.begin() + _resultWords, 0UL);
+		std::fill(_result._exceptfds.begin() + count, _result._exceptfds.begin() + _resultWords, 0UL);
+	}
+	_resultWords = count;
 	tv = initTimeout(timeout_ms);
-	if ((ready = ::select(_nfds, &sets._readfds, &sets._writefds, &sets._exceptfds, &tv)) == -1)
+	countSyscall(_syscalls);
+	if ((ready = ::select(_nfds, reinterpret_cast<fd_set *>(&_result._readfds[0]),
+			reinterpret_cast<fd_set *>(&_result._writefds[0]), reinterpret_cast<fd_set *>(&_result._exceptfds[0]),
+			timeout_ms < 0 ? NULL : &tv)) == -1)
+	{
+		_result.zero();
 		throw std::runtime_error("select failed: " + std::string(std::strerror(errno)));
+	}
 	if (ready)
-		processResults(sets);
-	return (ready);
+		processResults(ready);
+	return (static_cast<int>(_ready.size()));
 }
 
 /**
  * @brief Adds a file descriptor to monitor for events.
  *
+ * Adding an already monitored descriptor replaces its event mask and
+ * user pointer.
+ *
  * @param fd File descriptor to add.
- * @param mask Event mask to monitor (E_IN, E_OUT, E_EXCEPT).
- * @throw std::runtime_error If fd exceeds FD_SETSIZE.
+ * @param mask Event mask to monitor (E_IN, E_OUT, E_EXCEPT, E_EDGE, E_ONESHOT).
+ * @param data User pointer returned with the descriptor's ready events.
  */
-void SelectEventIO::add(int fd, e_Event mask)
+void SelectEventIO::add(int fd, e_Event mask, void *data)
 {
-	if (fd >= FD_SETSIZE)
-		throw std::runtime_error("file descriptor exceeds limit " + common::core::utils::toString(FD_SETSIZE));
-	if (fd >= _nfds)
-		_nfds = fd + 1;
-	_events[fd] = mask;
+	if (fd < 0)
+		return ;
+	grow(fd);
+	_events.insert(fd, Interest(mask, data));
+	setMaster(fd, mask);
 }
 
 /**
  * @brief Removes a file descriptor from monitoring.
  *
+ * A pending entry in the ready list is kept but reported as E_NONE, so
+ * that a caller iterating getReady() can remove descriptors safely.
+ *
  * @param fd File descriptor to remove.
  */
 void SelectEventIO::remove(int fd)
 {
-	std::map<int, e_Event>::iterator it = _events.find(fd);
-	if (it == _events.end())
+	if (!_events.erase(fd))
 		return ;
 
-	_events.erase(it);
-	_ready.erase(fd);
-	if (_events.empty())
-		_nfds = 0;
-	else
-		_nfds = std::max_element(_events.begin(), _events.end())->first + 1;
+	for (ReadyList::iterator rit = _ready.begin(); rit != _ready.end(); ++rit)
+		if (rit->fd == fd)
+			rit->events = E_NONE;
+	const unsigned long bit = 1UL << (fd % WORD_BITS);
+
+	_result._readfds[fd / WORD_BITS] &= ~bit;
+	_result._writefds[fd / WORD_BITS] &= ~bit;
+	_result._exceptfds[fd / WORD_BITS] &= ~bit;
+	setMaster(fd, E_NONE);
 }
 
 /**
  * @brief Updates the event mask for a monitored file descriptor.
  *
+ * Keeps the user pointer. Also re-arms a descriptor disarmed by E_EDGE
+ * or E_ONESHOT.
+ *
  * @param fd File descriptor to update.
  * @param mask New event mask.
  */
 void SelectEventIO::update(int fd, e_Event mask)
 {
-	std::map<int, e_Event>::iterator it = _events.find(fd);
-	if (it != _events.end())
-		it->second = mask;
+	Interest *interest = _events.find(fd);
+	if (interest == NULL)
+		return ;
+
+	interest->events = mask;
+	setMaster(fd, mask);
+}
+
+/**
+ * @brief Updates the event mask and user pointer for a monitored file descriptor.
+ *
+ * @param fd File descriptor to update.
+ * @param mask New event mask.
+ * @param data New user pointer.
+ */
+void SelectEventIO::update(int fd, e_Event mask, void *data)
+{
+	Interest *interest = _events.find(fd);
+	if (interest == NULL)
+		return ;
+
+	*interest = Interest(mask, data);
+	setMaster(fd, mask);
 }
 
+/**
+ * @brief Applies queued interest changes.
+ *
+ * Changes are applied to the master sets array as they are made, so there is
+ * nothing to do.
+ */
+void SelectEventIO::flush() {}
+
 /**
  * @brief Removes all monitored file descriptors.
+ *
+ * The bitmaps are cleared but keep their size.
  */
 void SelectEventIO::clear()
 {
 	_events.clear();
 	_ready.clear();
+	_master.zero();
+	_result.zero();
 	_nfds = 0;
+	_resultWords = 0;
 }
 
 /**
  * @brief Gets the detected events for a file descriptor.
  *
+ * Tests the descriptor bits in the result sets of the last select(2).
+ *
  * @param fd File descriptor to query.
  * @return Detected event mask (E_NONE if fd not monitored).
  */
 IEventIO::e_Event SelectEventIO::getEvents(int fd) const
 {
-	std::map<int, e_Event>::const_iterator it = _ready.find(fd);
-	if (it == _ready.end())
+	e_Event mask = E_NONE;
+	std::size_t i;
+	unsigned long bit;
+
+	if (fd < 0 || (i = fd / WORD_BITS) >= _result._readfds.size())
 		return (E_NONE);
-	return (it->second);
+	bit = 1UL << (fd % WORD_BITS);
+	if (_result._readfds[i] & bit)
+		mask = static_cast<e_Event>(mask | E_IN);
+	if (_result._writefds[i] & bit)
+		mask = static_cast<e_Event>(mask | E_OUT);
+	if (_result._exceptfds[i] & bit)
+		mask = static_cast<e_Event>(mask | E_EXCEPT);
+	return (mask);
 }
 
 /**
- * @brief Initializes fd_events structures based on monitored events.
+ * @brief Writes a descriptor's event mask into the master sets.
+ *
+ * Keeps _nfds on the highest descriptor present in any master set: it
+ * grows on add, and only clearing the current highest descriptor walks
+ * down the set words to find the next one.
  *
- * @param sets Sets structure to populate.
+ * @param fd File descriptor to update.
+ * @param mask Event mask to monitor, E_NONE to clear the descriptor.
  */
-void SelectEventIO::prepareWait(Sets &sets) const
+void SelectEventIO::setMaster(int fd, e_Event mask)
 {
-	std::map<int, e_Event>::const_iterator it;
-	for (it = _events.begin(); it != _events.end(); ++it)
+	const std::size_t w = fd / WORD_BITS;
+	const unsigned long bit = 1UL << (fd % WORD_BITS);
+
+	_master._readfds[w] &= ~bit;
+	_master._writefds[w] &= ~bit;
+	_master._exceptfds[w] &= ~bit;
+	if (mask & E_IN)
+		_master._readfds[w] |= bit;
+	if (mask & E_OUT)
+		_master._writefds[w] |= bit;
+	if (mask & E_EXCEPT)
+		_master._exceptfds[w] |= bit;
+
+	if (mask & (E_IN | E_OUT | E_EXCEPT))
 	{
-		if (it->second & E_IN)
-			FD_SET(it->first, &sets._readfds);
-		if (it->second & E_OUT)
-			FD_SET(it->first, &sets._writefds);
-		if (it->second & E_EXCEPT)
-			FD_SET(it->first, &sets._exceptfds);
+		if (fd >= _nfds)
+			_nfds = fd + 1;
+	}
+	else if (fd == _nfds - 1)
+	{
+		for (int i = fd / WORD_BITS; i >= 0; --i)
+		{
+			unsigned long word = _master._readfds[i] | _master._writefds[i] | _master._exceptfds[i];
+			if (word)
+			{
+				_nfds = i * WORD_BITS + (WORD_BITS - __builtin_clzl(word));
+				return ;
+			}
+		}
+		_nfds = 0;
 	}
 }
 
 /**
- * @brief Updates monitored events based on select(2) results.
+ * @brief Appends the descriptors set by select(2) to the ready list.
+ *
+ * The sets are walked one word at a time, each set bit is found with a
+ * count-trailing-zeros, and the walk stops once the @p ready bits counted
+ * by select(2) have all been seen.
+ * Reported descriptors registered with E_EDGE or E_ONESHOT are disarmed.
  *
- * @param sets Populated Sets structure from select(2).
+ * @param ready Number of bits set across the three result sets.
  */
-void SelectEventIO::processResults(Sets &sets)
+void SelectEventIO::processResults(int ready)
 {
-	_ready.clear();
-	for (int fd = 0; fd < _nfds; ++fd)
+	const std::size_t used = words(_nfds);
+
+	for (std::size_t i = 0; i < used && ready > 0; ++i)
 	{
-		e_Event mask = E_NONE;
-		if (FD_ISSET(fd, &sets._readfds))
-			mask = static_cast<e_Event>(mask | E_IN);
-		if (FD_ISSET(fd, &sets._writefds))
-			mask = static_cast<e_Event>(mask | E_OUT);
-		if (FD_ISSET(fd, &sets._exceptfds))
-			mask = static_cast<e_Event>(mask | E_EXCEPT);
-		if (mask)
-			_ready[fd] = mask;
+		unsigned long rd = _result._readfds[i];
+		unsigned long wr = _result._writefds[i];
+		unsigned long ex = _result._exceptfds[i];
+		unsigned long word = rd | wr | ex;
+
+		while (word)
+		{
+			unsigned long bit = word & -word;
+			e_Event mask = E_NONE;
+			if (rd & bit)
+				mask = static_cast<e_Event>(mask | E_IN), --ready;
+			if (wr & bit)
+				mask = static_cast<e_Event>(mask | E_OUT), --ready;
+			if (ex & bit)
+				mask = static_cast<e_Event>(mask | E_EXCEPT), --ready;
+
+			ReadyEvent ev;
+			ev.fd = static_cast<int>(i * WORD_BITS) + __builtin_ctzl(word);
+			ev.events = mask;
+			ev.data = NULL;
+			if (Interest *interest = _events.find(ev.fd))
+			{
+				ev.data = interest->data;
+				if (interest->events & (E_EDGE | E_ONESHOT))
+				{
+					interest->events = disarm(interest->events, mask);
+					setMaster(ev.fd, interest->events);
+				}
+			}
+			_ready.push_back(ev);
+			word &= word - 1;
+		}
 	}
 }
 
+/**
+ * @brief Grows the master and result bitmaps to hold a descriptor.
+ *
+ * The size at least doubles, so a growing descriptor range costs
+ * amortized constant time per add().
+ *
+ * @param fd Descriptor the bitmaps must hold.
+ */
+void SelectEventIO::grow(int fd)
+{
+	std::size_t needed = words(fd + 1);
+	std::size_t size = _master._readfds.size();
+
+	if (needed <= size)
+		return ;
+	_master.resize(std::max(needed, 2 * size));
+	_result.resize(std::max(needed, 2 * size));
+}
+
+/**
+ * @brief Counts the bitmap words holding descriptors below nfds.
+ *
+ * @param nfds Number of descriptors.
+ * @return Number of words.
+ */
+std::size_t SelectEventIO::words(int nfds)
+{
+	return ((static_cast<std::size_t>(nfds) + WORD_BITS - 1) / WORD_BITS);
+}
+
 /**
  * @brief Converts millisecond timeout to timeval structure.
  *
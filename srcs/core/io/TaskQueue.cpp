@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   TaskQueue.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/TaskQueue.hpp>
+#include <cstddef>
+
+/**
+ * @file TaskQueue.cpp
+ * @brief Implementation of the lock-free task queue.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @brief Default constructor. Creates an empty queue.
+ */
+TaskQueue::TaskQueue() : _head(NULL) {}
+
+/**
+ * @brief Destructor. Pending tasks are not run; they are not owned.
+ */
+TaskQueue::~TaskQueue() {}
+
+/**
+ * @brief Appends a task. Safe to call from any thread.
+ *
+ * @param task Task to post, not owned.
+ * @return true if the queue was empty before the call.
+ */
+bool	TaskQueue::push(ATask *task)
+{
+	ATask *head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+
+	do
+		task->_next = head;
+	while (!__atomic_compare_exchange_n(&_head, &head, task, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+	return (head == NULL);
+}
+
+/**
+ * @brief Runs the tasks posted so far, oldest first.
+ *
+ * Consumer side only. Tasks posted while running are left for the next
+ * call, which bounds the work done by one call.
+ *
+ * @return Number of tasks run.
+ */
+std::size_t	TaskQueue::run()
+{
+	ATask *task = __atomic_exchange_n(&_head, static_cast<ATask *>(NULL), __ATOMIC_ACQUIRE);
+	ATask *fifo = NULL;
+	std::size_t count = 0;
+
+	while (task)
+	{
+		ATask *next = task->_next;
+
+		task->_next = fifo;
+		fifo = task;
+		task = next;
+	}
+	while (fifo)
+	{
+		ATask *next = fifo->_next;
+
+		fifo->run();
+		fifo = next;
+		++count;
+	}
+	return (count);
+}
+
+/**
+ * @brief Tells whether no task is pending.
+ *
+ * @return true if the queue is empty.
+ */
+bool	TaskQueue::empty() const
+{
+	return (__atomic_load_n(&_head, __ATOMIC_ACQUIRE) == NULL);
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,334 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ThreadPool.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/EventLoopGroup.hpp>
+#include <common/core/io/ThreadPool.hpp>
+#include <cstddef>
+#include <cstring>
+#include <pthread.h>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of the work-stealing thread pool.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @brief Constructor. Starts the workers.
+ *
+ * @param count Number of workers, 0 for one per available CPU.
+ * @throw std::runtime_error If a thread or synchronisation object cannot be created.
+ */
+ThreadPool::ThreadPool(std::size_t count) : _workers(), _injection(), _injected(0), _sleeping(0), _running(true)
+{
+	int rc;
+
+	if (count == 0)
+		count = EventLoopGroup::cpuCount();
+	if ((rc = ::pthread_key_create(&_key, NULL)) != 0)
+		throw std::runtime_error("pthread_key_create failed: " + std::string(std::strerror(rc)));
+	::pthread_mutex_init(&_mutex, NULL);
+	::pthread_cond_init(&_cond, NULL);
+	_workers.reserve(count);
+	for (std::size_t i = 0; i < count; ++i)
+		_workers.push_back(new Worker(this, 2654435761UL * (i + 1)));
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		if ((rc = ::pthread_create(&_workers[i]->thread, NULL, &ThreadPool::threadMain, _workers[i])) != 0)
+		{
+			stop();
+			for (std::size_t j = 0; j < count; ++j)
+				delete _workers[j];
+			::pthread_cond_destroy(&_cond);
+			::pthread_mutex_destroy(&_mutex);
+			::pthread_key_delete(_key);
+			throw std::runtime_error("pthread_create failed: " + std::string(std::strerror(rc)));
+		}
+		_workers[i]->started = true;
+	}
+}
+
+/**
+ * @brief Constructor. Creates the deque of a worker.
+ *
+ * @param owner Pool the worker belongs to.
+ * @param init_seed Seed of the victim selection, not 0.
+ */
+ThreadPool::Worker::Worker(ThreadPool *owner, unsigned long init_seed) : pool(owner), deque(), thread(), seed(init_seed), started(false) {}
+
+/**
+ * @brief Destructor. Stops and joins the workers.
+ */
+ThreadPool::~ThreadPool()
+{
+	stop();
+	for (std::size_t i = 0; i < _workers.size(); ++i)
+		delete _workers[i];
+	_workers.clear();
+	::pthread_cond_destroy(&_cond);
+	::pthread_mutex_destroy(&_mutex);
+	::pthread_key_delete(_key);
+}
+
+/**
+ * @brief Queues a task. Safe from any thread.
+ *
+ * From a worker of this pool, the task goes to the worker's own deque;
+ * from any other thread, to the injection queue.
+ *
+ * @param task Task to run, not owned.
+ * @throw std::runtime_error If task is NULL or the pool is stopped.
+ */
+void	ThreadPool::submit(ATask *task)
+{
+	Worker *self = static_cast<Worker *>(::pthread_getspecific(_key));
+
+	if (task == NULL)
+		throw std::runtime_error("ThreadPool: NULL task");
+	if (__atomic_load_n(&_running, __ATOMIC_ACQUIRE) == false)
+		throw std::runtime_error("ThreadPool: stopped");
+	if (self != NULL)
+	{
+		self->deque.push(task);
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&_sleeping, __ATOMIC_RELAXED) != 0)
+			wakeOne();
+		return ;
+	}
+	::pthread_mutex_lock(&_mutex);
+	_injection.push_back(task);
+	__atomic_store_n(&_injected, _injection.size(), __ATOMIC_RELAXED);
+	if (_sleeping != 0)
+		::pthread_cond_signal(&_cond);
+	::pthread_mutex_unlock(&_mutex);
+}
+
+/**
+ * @brief Stops the workers after their current task and joins them.
+ *
+ * Must not be called from a worker. Does nothing if already stopped.
+ */
+void	ThreadPool::stop()
+{
+	::pthread_mutex_lock(&_mutex);
+	__atomic_store_n(&_running, false, __ATOMIC_RELEASE);
+	::pthread_cond_broadcast(&_cond);
+	::pthread_mutex_unlock(&_mutex);
+	for (std::size_t i = 0; i < _workers.size(); ++i)
+	{
+		if (_workers[i]->started)
+		{
+			::pthread_join(_workers[i]->thread, NULL);
+			_workers[i]->started = false;
+		}
+	}
+}
+
+/**
+ * @brief Gets the number of workers.
+ *
+ * @return Number of workers.
+ */
+std::size_t	ThreadPool::size() const
+{
+	return (_workers.size());
+}
+
+/**
+ * @brief Thread body of a worker.
+ *
+ * @param arg Worker of the thread.
+ * @return NULL.
+ */
+void	*ThreadPool::threadMain(void *arg)
+{
+	Worker *worker = static_cast<Worker *>(arg);
+
+	::pthread_setspecific(worker->pool->_key, worker);
+	worker->pool->work(*worker);
+	return (NULL);
+}
+
+/**
+ * @brief Runs tasks until the pool stops, parking when there are none.
+ *
+ * @param worker Calling worker.
+ */
+void	ThreadPool::work(Worker &worker)
+{
+	while (__atomic_load_n(&_running, __ATOMIC_ACQUIRE))
+	{
+		ATask *task = find(worker);
+
+		if (task == NULL)
+			task = park();
+		if (task != NULL)
+			task->run();
+	}
+}
+
+/**
+ * @brief Looks for a task without blocking.
+ *
+ * Tries the worker's own deque, then the injection queue, then the other
+ * workers. Taking from the injection queue also moves a batch of tasks
+ * to the worker's deque, where idle workers can steal them.
+ *
+ * @param worker Calling worker.
+ * @return Task, or NULL if none was found.
+ */
+ATask	*ThreadPool::find(Worker &worker)
+{
+	const std::size_t batch = 32;
+	ATask *task = worker.deque.take();
+
+	if (task == NULL && __atomic_load_n(&_injected, __ATOMIC_RELAXED) != 0)
+	{
+		::pthread_mutex_lock(&_mutex);
+		for (std::size_t i = 0; i < batch && _injection.empty() == false; ++i)
+		{
+			if (task == NULL)
+				task = _injection.front();
+			else
+				worker.deque.push(_injection.front());
+			_injection.pop_front();
+		}
+		__atomic_store_n(&_injected, _injection.size(), __ATOMIC_RELAXED);
+		::pthread_mutex_unlock(&_mutex);
+	}
+	if (task == NULL)
+		task = steal(worker);
+	return (task);
+}
+
+/**
+ * @brief Tries to steal a task from every other worker once, starting at
+ * a random victim.
+ *
+ * @param worker Calling worker.
+ * @return Task, or NULL if none was stolen.
+ */
+ATask	*ThreadPool::steal(Worker &worker)
+{
+	const std::size_t count = _workers.size();
+	std::size_t start;
+
+	worker.seed ^= worker.seed << 13;
+	worker.seed ^= worker.seed >> 7;
+	worker.seed ^= worker.seed << 17;
+	start = worker.seed % count;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		Worker *victim = _workers[(start + i) % count];
+		ATask *task;
+
+		if (victim == &worker)
+			continue ;
+		if ((task = victim->deque.steal()) != NULL)
+			return (task);
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Sleeps until work is available or the pool stops.
+ *
+ * The sleeping count is raised before checking for work, and submitters
+ * check it after queuing, so a submission cannot slip between the check
+ * and the wait unnoticed.
+ *
+ * @return Task taken from the injection queue, or NULL to look again.
+ */
+ATask	*ThreadPool::park()
+{
+	ATask *task = NULL;
+
+	::pthread_mutex_lock(&_mutex);
+	__atomic_add_fetch(&_sleeping, 1, __ATOMIC_SEQ_CST);
+	while (__atomic_load_n(&_running, __ATOMIC_ACQUIRE) && hasWork() == false)
+		::pthread_cond_wait(&_cond, &_mutex);
+	__atomic_sub_fetch(&_sleeping, 1, __ATOMIC_SEQ_CST);
+	if (_injection.empty() == false)
+	{
+		task = _injection.front();
+		_injection.pop_front();
+		__atomic_store_n(&_injected, _injection.size(), __ATOMIC_RELAXED);
+	}
+	::pthread_mutex_unlock(&_mutex);
+	return (task);
+}
+
+/**
+ * @brief Tells whether any task is queued. Called with the mutex held.
+ *
+ * @return true if the injection queue or a deque holds a task.
+ */
+bool	ThreadPool::hasWork() const
+{
+	if (_injection.empty() == false)
+		return (true);
+	for (std::size_t i = 0; i < _workers.size(); ++i)
+	{
+		if (_workers[i]->deque.empty() == false)
+			return (true);
+	}
+	return (false);
+}
+
+/**
+ * @brief Wakes up one parked worker.
+ */
+void	ThreadPool::wakeOne()
+{
+	::pthread_mutex_lock(&_mutex);
+	::pthread_cond_signal(&_cond);
+	::pthread_mutex_unlock(&_mutex);
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
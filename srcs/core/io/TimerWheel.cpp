@@ -0,0 +1,447 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   TimerWheel.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/TimerWheel.hpp>
+#include <climits>
+#include <cstddef>
+
+/**
+ * @file TimerWheel.cpp
+ * @brief Implementation of the hierarchical timer wheel.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+const int			TimerWheel::SLOT_BITS;
+const int			TimerWheel::SLOTS;
+const int			TimerWheel::LEVELS;
+const unsigned long	TimerWheel::MAX_DELAY;
+
+/**
+ * @brief Constructor. Creates an unscheduled timer.
+ *
+ * @param handler Handler called on expiry, not owned (may be NULL).
+ */
+Timer::Timer(ITimerHandler *handler) : _handler(handler), _wheel(NULL), _prev(NULL), _next(NULL), _expiry(0), _level(0), _slot(0) {}
+
+/**
+ * @brief Destructor. Cancels the timer if it is scheduled.
+ */
+Timer::~Timer()
+{
+	if (_wheel)
+		_wheel->cancel(*this);
+}
+
+/**
+ * @brief Sets the handler called on expiry.
+ *
+ * @param handler Handler, not owned (may be NULL).
+ */
+void	Timer::setHandler(ITimerHandler *handler)
+{
+	_handler = handler;
+}
+
+/**
+ * @brief Gets the handler called on expiry.
+ *
+ * @return Handler, NULL if none.
+ */
+ITimerHandler	*Timer::getHandler() const
+{
+	return (_handler);
+}
+
+/**
+ * @brief Tells whether the timer is scheduled on a wheel.
+ *
+ * @return true until the timer expires or is cancelled.
+ */
+bool	Timer::isScheduled() const
+{
+	return (_wheel != NULL);
+}
+
+/**
+ * @brief Gets the time at which the timer expires.
+ *
+ * @return Expiry in the time base of the wheel, meaningful while scheduled.
+ */
+unsigned long	Timer::getExpiry() const
+{
+	return (_expiry);
+}
+
+/**
+ * @brief Constructor.
+ *
+ * @param now Current time in milliseconds.
+ */
+TimerWheel::TimerWheel(unsigned long now) : _current(now), _now(now), _size(0)
+{
+	for (int level = 0; level < LEVELS; ++level)
+	{
+		for (int slot = 0; slot < SLOTS; ++slot)
+			_slots[level][slot] = NULL;
+		_occupied[level] = 0;
+	}
+}
+
+/**
+ * @brief Destructor. Unschedules the remaining timers.
+ */
+TimerWheel::~TimerWheel()
+{
+	clear();
+}
+
+/**
+ * @brief Schedules or reschedules a timer.
+ *
+ * A timer already scheduled, on this wheel or another one, is moved: this
+ * is the cheap way to push a deadline back.
+ *
+ * @param timer Timer to schedule.
+ * @param delay_ms Delay from getTime(), 0 expires on the next tick.
+ */
+void	TimerWheel::schedule(Timer &timer, unsigned long delay_ms)
+{
+	if (timer._wheel == this)
+		unlink(timer);
+	else
+	{
+		if (timer._wheel)
+			timer._wheel->cancel(timer);
+		timer._wheel = this;
+		++_size;
+	}
+	if (delay_ms == 0)
+		delay_ms = 1;
+	if (delay_ms > static_cast<unsigned long>(LONG_MAX))
+		delay_ms = static_cast<unsigned long>(LONG_MAX);
+	timer._expiry = _now + delay_ms;
+	link(timer);
+}
+
+/**
+ * @brief Unschedules a timer. Does nothing if it is not on this wheel.
+ *
+ * @param timer Timer to cancel.
+ */
+void	TimerWheel::cancel(Timer &timer)
+{
+	if (timer._wheel != this)
+		return ;
+	unlink(timer);
+	timer._wheel = NULL;
+	--_size;
+}
+
+/**
+ * @brief Moves the wheel forward and runs the expired timers.
+ *
+ * Ticks are processed in order; runs of empty level-0 slots are skipped
+ * using the occupancy bits, and the wheel jumps straight to now when no
+ * timer is scheduled.
+ *
+ * @param now Current time in milliseconds.
+ * @return Number of timers that expired.
+ */
+std::size_t	TimerWheel::advance(unsigned long now)
+{
+	std::size_t fired = 0;
+
+	if (before(_now, now))
+		_now = now;
+	while (before(_current, _now))
+	{
+		unsigned long tick = _current + 1;
+		unsigned long index = tick & (SLOTS - 1);
+
+		if (_size == 0)
+		{
+			_current = _now;
+			break ;
+		}
+		if (index != 0)
+		{
+			unsigned long bits = _occupied[0] >> index;
+
+			tick = bits ? tick + __builtin_ctzl(bits) : (tick | (SLOTS - 1)) + 1;
+			if (before(_now, tick))
+			{
+				_current = _now;
+				break ;
+			}
+			index = tick & (SLOTS - 1);
+		}
+		_current = tick;
+		for (int level = 1; index == 0 && level < LEVELS; ++level)
+		{
+			index = (tick >> (SLOT_BITS * level)) & (SLOTS - 1);
+			cascade(level, static_cast<int>(index));
+		}
+		fired += expire(tick);
+	}
+	return (fired);
+}
+
+/**
+ * @brief Gets the delay until the wheel needs to be advanced.
+ *
+ * Exact for deadlines within the lowest level. Farther deadlines yield
+ * the time of the cascade that brings them closer, which is never later
+ * than the deadline itself. The cost is one word scan per level.
+ *
+ * @return Delay in milliseconds, or -1 if no timer is scheduled.
+ */
+int	TimerWheel::nextTimeout() const
+{
+	unsigned long best = ULONG_MAX;
+
+	if (_size == 0)
+		return (-1);
+	for (int level = 0; level < LEVELS; ++level)
+	{
+		unsigned long bits = _occupied[level];
+		int shift = SLOT_BITS * level;
+		unsigned long base;
+		int from;
+		unsigned long delay;
+
+		if (bits == 0)
+			continue ;
+		base = _current >> shift;
+		from = static_cast<int>((base + 1) & (SLOTS - 1));
+		if (from != 0)
+			bits = (bits >> from) | (bits << (SLOTS - from));
+		delay = ((base + 1 + __builtin_ctzl(bits)) << shift) - _current;
+		if (delay < best)
+			best = delay;
+	}
+	if (best > static_cast<unsigned long>(INT_MAX))
+		return (INT_MAX);
+	return (static_cast<int>(best));
+}
+
+/**
+ * @brief Gets the current time of the wheel.
+ *
+ * @return Time given to the last advance(), or to the constructor.
+ */
+unsigned long	TimerWheel::getTime() const
+{
+	return (_now);
+}
+
+/**
+ * @brief Gets the number of scheduled timers.
+ *
+ * @return Number of timers.
+ */
+std::size_t	TimerWheel::size() const
+{
+	return (_size);
+}
+
+/**
+ * @brief Tells whether no timer is scheduled.
+ *
+ * @return true if the wheel is empty.
+ */
+bool	TimerWheel::empty() const
+{
+	return (_size == 0);
+}
+
+/**
+ * @brief Unschedules every timer without running them.
+ */
+void	TimerWheel::clear()
+{
+	for (int level = 0; level < LEVELS; ++level)
+	{
+		for (int slot = 0; slot < SLOTS; ++slot)
+		{
+			Timer *timer = _slots[level][slot];
+
+			while (timer)
+			{
+				Timer *next = timer->_next;
+
+				timer->_wheel = NULL;
+				timer->_prev = NULL;
+				timer->_next = NULL;
+				timer = next;
+			}
+			_slots[level][slot] = NULL;
+		}
+		_occupied[level] = 0;
+	}
+	_size = 0;
+}
+
+/**
+ * @brief Inserts a timer in the slot matching its expiry.
+ *
+ * The level is the one whose span covers the distance to the expiry;
+ * expiries beyond MAX_DELAY are hashed as if they were MAX_DELAY away
+ * and rehashed when their slot is cascaded.
+ *
+ * @param timer Timer to insert, with _expiry set.
+ */
+void	TimerWheel::link(Timer &timer)
+{
+	unsigned long expiry = timer._expiry;
+	unsigned long delta;
+	int level = 0;
+	int slot;
+
+	if (before(expiry, _current))
+		expiry = _current;
+	delta = expiry - _current;
+	if (delta > MAX_DELAY)
+	{
+		expiry = _current + MAX_DELAY;
+		delta = MAX_DELAY;
+	}
+	while (level < LEVELS - 1 && (delta >> (SLOT_BITS * (level + 1))) != 0)
+		++level;
+	slot = static_cast<int>((expiry >> (SLOT_BITS * level)) & (SLOTS - 1));
+	timer._level = level;
+	timer._slot = slot;
+	timer._prev = NULL;
+	timer._next = _slots[level][slot];
+	if (timer._next)
+		timer._next->_prev = &timer;
+	_slots[level][slot] = &timer;
+	_occupied[level] |= 1UL << slot;
+}
+
+/**
+ * @brief Removes a timer from its slot.
+ *
+ * @param timer Timer to remove, linked on this wheel.
+ */
+void	TimerWheel::unlink(Timer &timer)
+{
+	if (timer._prev)
+		timer._prev->_next = timer._next;
+	else
+	{
+		_slots[timer._level][timer._slot] = timer._next;
+		if (timer._next == NULL)
+			_occupied[timer._level] &= ~(1UL << timer._slot);
+	}
+	if (timer._next)
+		timer._next->_prev = timer._prev;
+	timer._prev = NULL;
+	timer._next = NULL;
+}
+
+/**
+ * @brief Rehashes the timers of a slot relative to the current tick.
+ *
+ * @param level Level of the slot, greater than 0.
+ * @param slot Index of the slot.
+ */
+void	TimerWheel::cascade(int level, int slot)
+{
+	Timer *timer = _slots[level][slot];
+
+	_slots[level][slot] = NULL;
+	_occupied[level] &= ~(1UL << slot);
+	while (timer)
+	{
+		Timer *next = timer->_next;
+
+		link(*timer);
+		timer = next;
+	}
+}
+
+/**
+ * @brief Runs the timers of the level-0 slot of a tick.
+ *
+ * Each timer is unscheduled before its handler runs. A handler cannot
+ * reschedule into the slot being drained, as the smallest delay lands on
+ * the next tick.
+ *
+ * @param tick Tick being processed.
+ * @return Number of timers that expired.
+ */
+std::size_t	TimerWheel::expire(unsigned long tick)
+{
+	const int slot = static_cast<int>(tick & (SLOTS - 1));
+	std::size_t fired = 0;
+	Timer *timer;
+
+	while ((timer = _slots[0][slot]) != NULL)
+	{
+		unlink(*timer);
+		timer->_wheel = NULL;
+		--_size;
+		++fired;
+		if (timer->_handler)
+			timer->_handler->onTimeout(*timer);
+	}
+	return (fired);
+}
+
+/**
+ * @brief Compares two times, allowing for wrap-around.
+ *
+ * @param lhs First time.
+ * @param rhs Second time.
+ * @return true if lhs is earlier than rhs.
+ */
+bool	TimerWheel::before(unsigned long lhs, unsigned long rhs)
+{
+	return (static_cast<long>(lhs - rhs) < 0);
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   WakeupChannel.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/WakeupChannel.hpp>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+#if defined(__linux__)
+# include <sys/eventfd.h>
+#endif
+
+/**
+ * @file WakeupChannel.cpp
+ * @brief Implementation of the event loop wakeup descriptor.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+/**
+ * @brief Default constructor. Creates the eventfd, or the pipe.
+ *
+ * @throw std::runtime_error If the descriptors cannot be created.
+ */
+WakeupChannel::WakeupChannel() : _readFd(), _writeFd()
+{
+#if defined(__linux__)
+	_readFd.reset(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+	if (_readFd.valid() == false)
+		throw std::runtime_error("eventfd failed: " + std::string(std::strerror(errno)));
+#else
+	int fds[2];
+
+	if (::pipe(fds) == -1)
+		throw std::runtime_error("pipe failed: " + std::string(std::strerror(errno)));
+	_readFd.reset(fds[0]);
+	_writeFd.reset(fds[1]);
+	for (int i = 0; i < 2; ++i)
+	{
+		if (::fcntl(fds[i], F_SETFL, ::fcntl(fds[i], F_GETFL) | O_NONBLOCK) == -1
+			|| ::fcntl(fds[i], F_SETFD, FD_CLOEXEC) == -1)
+			throw std::runtime_error("fcntl failed: " + std::string(std::strerror(errno)));
+	}
+#endif
+}
+
+/**
+ * @brief Destructor. The descriptors are closed by their UniqueFd.
+ */
+WakeupChannel::~WakeupChannel() {}
+
+/**
+ * @brief Gets the descriptor to register for E_IN.
+ *
+ * @return Readable end of the channel.
+ */
+int	WakeupChannel::getFd() const
+{
+	return (_readFd.get());
+}
+
+/**
+ * @brief Makes the channel readable. Safe to call from any thread.
+ *
+ * A full counter or pipe means a wakeup is already pending, so the
+ * resulting EAGAIN is ignored.
+ */
+void	WakeupChannel::signal()
+{
+#if defined(__linux__)
+	while (::eventfd_write(_readFd.get(), 1) == -1 && errno == EINTR)
+		;
+#else
+	const char byte = 0;
+
+	while (::write(_writeFd.get(), &byte, 1) == -1 && errno == EINTR)
+		;
+#endif
+}
+
+/**
+ * @brief Consumes the pending signals. Loop thread only.
+ */
+void	WakeupChannel::drain()
+{
+#if defined(__linux__)
+	eventfd_t value;
+
+	while (::eventfd_read(_readFd.get(), &value) == -1 && errno == EINTR)
+		;
+#else
+	char buf[64];
+	ssize_t n;
+
+	do
+		n = ::read(_readFd.get(), buf, sizeof(buf));
+	while (n > 0 || (n == -1 && errno == EINTR));
+#endif
+}
+
+/**
+ * @brief Resets the channel when it is reported readable.
+ *
+ * @param fd Channel descriptor (unused).
+ */
+void	WakeupChannel::onRead(int fd)
+{
+	(void)fd;
+	drain();
+}
+
+/**
+ * @brief Unused, the channel is only monitored for E_IN.
+ *
+ * @param fd Channel descriptor (unused).
+ */
+void	WakeupChannel::onWrite(int fd)
+{
+	(void)fd;
+}
+
+/**
+ * @brief Unused, the channel is only monitored for E_IN.
+ *
+ * @param fd Channel descriptor (unused).
+ */
+void	WakeupChannel::onError(int fd)
+{
+	(void)fd;
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
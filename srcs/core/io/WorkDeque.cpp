@@ -0,0 +1,192 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   WorkDeque.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/io/WorkDeque.hpp>
+#include <cstddef>
+
+/**
+ * @file WorkDeque.cpp
+ * @brief Implementation of the Chase-Lev work-stealing deque.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace io
+{
+
+const long	WorkDeque::INITIAL_CAPACITY;
+const int	WorkDeque::CACHE_LINE;
+
+/**
+ * @brief Default constructor. Creates an empty deque.
+ */
+WorkDeque::WorkDeque() : _top(0), _bottom(0), _buffer(new Buffer(INITIAL_CAPACITY, NULL)) {}
+
+/**
+ * @brief Constructor. Allocates the slots of a buffer.
+ *
+ * @param init_capacity Number of slots, a power of two.
+ * @param init_previous Buffer replaced by this one, or NULL.
+ */
+WorkDeque::Buffer::Buffer(long init_capacity, Buffer *init_previous) : capacity(init_capacity), slots(new ATask *[init_capacity]), previous(init_previous) {}
+
+/**
+ * @brief Destructor. Frees the slots and the buffers replaced before.
+ */
+WorkDeque::Buffer::~Buffer()
+{
+	delete [] slots;
+	delete previous;
+}
+
+/**
+ * @brief Destructor. Tasks still queued are not owned and left untouched.
+ */
+WorkDeque::~WorkDeque()
+{
+	delete _buffer;
+}
+
+/**
+ * @brief Pushes a task at the bottom. Owner thread only.
+ *
+ * @param task Task to push, not owned.
+ */
+void	WorkDeque::push(ATask *task)
+{
+	long bottom = __atomic_load_n(&_bottom, __ATOMIC_RELAXED);
+	long top = __atomic_load_n(&_top, __ATOMIC_ACQUIRE);
+	Buffer *buffer = __atomic_load_n(&_buffer, __ATOMIC_RELAXED);
+
+	if (bottom - top > buffer->capacity - 1)
+		buffer = grow(buffer, top, bottom);
+	__atomic_store_n(&buffer->slots[bottom & (buffer->capacity - 1)], task, __ATOMIC_RELAXED);
+	__atomic_store_n(&_bottom, bottom + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Takes the newest task. Owner thread only.
+ *
+ * @return Task, or NULL if the deque is empty.
+ */
+ATask	*WorkDeque::take()
+{
+	long bottom = __atomic_load_n(&_bottom, __ATOMIC_RELAXED) - 1;
+	Buffer *buffer = __atomic_load_n(&_buffer, __ATOMIC_RELAXED);
+	long top;
+	ATask *task = NULL;
+
+	__atomic_store_n(&_bottom, bottom, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	top = __atomic_load_n(&_top, __ATOMIC_RELAXED);
+	if (top <= bottom)
+	{
+		task = __atomic_load_n(&buffer->slots[bottom & (buffer->capacity - 1)], __ATOMIC_RELAXED);
+		if (top == bottom)
+		{
+			if (!__atomic_compare_exchange_n(&_top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+				task = NULL;
+			__atomic_store_n(&_bottom, bottom + 1, __ATOMIC_RELAXED);
+		}
+	}
+	else
+		__atomic_store_n(&_bottom, bottom + 1, __ATOMIC_RELAXED);
+	return (task);
+}
+
+/**
+ * @brief Steals the oldest task. Safe from any thread.
+ *
+ * @return Task, or NULL if the deque is empty or another thread won the
+ *         race for the same task.
+ */
+ATask	*WorkDeque::steal()
+{
+	long top = __atomic_load_n(&_top, __ATOMIC_ACQUIRE);
+	long bottom;
+	Buffer *buffer;
+	ATask *task;
+
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	bottom = __atomic_load_n(&_bottom, __ATOMIC_ACQUIRE);
+	if (top >= bottom)
+		return (NULL);
+	buffer = __atomic_load_n(&_buffer, __ATOMIC_ACQUIRE);
+	task = __atomic_load_n(&buffer->slots[top & (buffer->capacity - 1)], __ATOMIC_RELAXED);
+	if (!__atomic_compare_exchange_n(&_top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+		return (NULL);
+	return (task);
+}
+
+/**
+ * @brief Tells whether the deque looks empty. Safe from any thread.
+ *
+ * @return true if no task was queued at the time of the call.
+ */
+bool	WorkDeque::empty() const
+{
+	long top = __atomic_load_n(&_top, __ATOMIC_ACQUIRE);
+	long bottom = __atomic_load_n(&_bottom, __ATOMIC_ACQUIRE);
+
+	return (top >= bottom);
+}
+
+/**
+ * @brief Replaces the buffer with one twice as large. Owner thread only.
+ *
+ * @param buffer Current buffer.
+ * @param top Index of the oldest task.
+ * @param bottom Index past the newest task.
+ * @return New buffer.
+ */
+WorkDeque::Buffer	*WorkDeque::grow(Buffer *buffer, long top, long bottom)
+{
+	Buffer *larger = new Buffer(buffer->capacity * 2, buffer);
+
+	for (long i = top; i < bottom; ++i)
+		larger->slots[i & (larger->capacity - 1)] = buffer->slots[i & (buffer->capacity - 1)];
+	__atomic_store_n(&_buffer, larger, __ATOMIC_RELEASE);
+	return (larger);
+}
+
+} // !io
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -99,7 +99,7 @@ ASocket::ASocket(int init_fd) : _fd(init_fd)
  * @param isNonblock Whether to set the socket as non-blocking.
  * @throw std::runtime_error If socket creation fails.
  */
-ASocket::ASocket(int domain, int type, int protocol, bool isNonblock) : _fd(::socket(domain, type, protocol))
+ASocket::ASocket(int domain, int type, int protocol, bool isNonblock) : _fd(::socket(domain, type, protocol)), _isNonblock(false)
 {
 
 	if (_fd.valid() == false)
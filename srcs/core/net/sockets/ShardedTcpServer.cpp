@@ -0,0 +1,239 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ShardedTcpServer.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/**
+ * @file ShardedTcpServer.cpp
+ * @brief Implementation of the SO_REUSEPORT sharded TCP server.
+ */
+
+#include <common/core/net/sockets/ShardedTcpServer.hpp>
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+
+namespace common
+{
+namespace core
+{
+namespace net
+{
+
+const int	ShardedTcpServer::ACCEPT_BATCH;
+
+/**
+ * @brief Constructor. Creates, binds and registers one listener per loop.
+ *
+ * @param group Loops to shard the server across, not running yet.
+ * @param addr Local address to listen on.
+ * @param addrlen Length of the address structure.
+ * @param handler Handler receiving the accepted connections, not owned.
+ * @param backlog Maximum number of pending connections per listener.
+ * @throw std::runtime_error If the group is running, handler is NULL or a
+ *        socket operation fails.
+ */
+ShardedTcpServer::ShardedTcpServer(common::core::io::EventLoopGroup &group, const struct sockaddr *addr, socklen_t addrlen, IAcceptHandler *handler, int backlog) : _listeners()
+{
+	struct sockaddr_storage bound;
+
+	if (group.isRunning())
+		throw std::runtime_error("ShardedTcpServer: group already running");
+	if (handler == NULL)
+		throw std::runtime_error("ShardedTcpServer: NULL handler");
+	_listeners.reserve(group.size());
+	try
+	{
+		for (std::size_t i = 0; i < group.size(); ++i)
+		{
+			_listeners.push_back(new Listener(addr->sa_family, &group.getLoop(i), handler));
+
+			TcpServer &server = _listeners.back()->server;
+
+			server.setsockopt(SO_REUSEADDR, 1);
+#if defined(SO_REUSEPORT)
+			server.setsockopt(SO_REUSEPORT, 1);
+#endif
+			server.bind(addr, addrlen);
+			server.listen(backlog);
+			if (i == 0)
+			{
+				bound = server.getsockname<struct sockaddr_storage>();
+				addr = reinterpret_cast<const struct sockaddr *>(&bound);
+			}
+			group.getLoop(i).add(server.getFd(), common::core::io::IEventIO::E_IN, _listeners.back());
+		}
+	}
+	catch (...)
+	{
+		release();
+		throw ;
+	}
+}
+
+/**
+ * @brief Constructor. Creates the non-blocking listening socket of a loop.
+ *
+ * @param domain Address family of the socket.
+ * @param init_loop Loop the listener is registered on.
+ * @param init_handler Handler receiving the accepted connections.
+ */
+ShardedTcpServer::Listener::Listener(int domain, common::core::io::EventLoop *init_loop, IAcceptHandler *init_handler) : server(domain, IPPROTO_TCP, true), loop(init_loop), handler(init_handler), accepted(0) {}
+
+/**
+ * @brief Destructor. Unregisters and closes the listeners.
+ */
+ShardedTcpServer::~ShardedTcpServer()
+{
+	release();
+}
+
+/**
+ * @brief Gets the number of listeners, one per loop.
+ *
+ * @return Number of listeners.
+ */
+std::size_t	ShardedTcpServer::size() const
+{
+	return (_listeners.size());
+}
+
+/**
+ * @brief Gets the listening socket of a loop.
+ *
+ * @param shard Loop index.
+ * @return Listening socket.
+ * @throw std::out_of_range If shard is out of range.
+ */
+const TcpServer	&ShardedTcpServer::getServer(std::size_t shard) const
+{
+	if (shard >= _listeners.size())
+		throw std::out_of_range("ShardedTcpServer: shard index out of range");
+	return (_listeners[shard]->server);
+}
+
+/**
+ * @brief Gets the number of connections accepted by a loop.
+ *
+ * @param shard Loop index.
+ * @return Accepted connections since construction.
+ * @throw std::out_of_range If shard is out of range.
+ */
+unsigned long	ShardedTcpServer::getAccepted(std::size_t shard) const
+{
+	if (shard >= _listeners.size())
+		throw std::out_of_range("ShardedTcpServer: shard index out of range");
+	return (__atomic_load_n(&_listeners[shard]->accepted, __ATOMIC_RELAXED));
+}
+
+/**
+ * @brief Unregisters and destroys the listeners.
+ */
+void	ShardedTcpServer::release()
+{
+	for (std::size_t i = 0; i < _listeners.size(); ++i)
+	{
+		if (_listeners[i]->server.getFd() != -1)
+			_listeners[i]->loop->remove(_listeners[i]->server.getFd());
+		delete _listeners[i];
+	}
+	_listeners.clear();
+}
+
+/**
+ * @brief Accepts the pending connections, up to ACCEPT_BATCH.
+ *
+ * Stops on EAGAIN and on resource exhaustion, which leaves the remaining
+ * connections queued in the kernel for the next event.
+ *
+ * @param fd Listening socket descriptor.
+ * @throw std::runtime_error If accept fails for another reason.
+ */
+void	ShardedTcpServer::Listener::onRead(int fd)
+{
+	for (int i = 0; i < ACCEPT_BATCH; ++i)
+	{
+#if defined(__linux__)
+		int cfd = ::accept4(fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+		int cfd = ::accept(fd, NULL, NULL);
+#endif
+		if (cfd == -1)
+		{
+			if (errno == EINTR || errno == ECONNABORTED)
+				continue ;
+			if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EMFILE
+				|| errno == ENFILE || errno == ENOBUFS || errno == ENOMEM)
+				return ;
+			throw std::runtime_error("accept failed: " + std::string(std::strerror(errno)));
+		}
+
+		TcpClient client(cfd);
+
+		if (client.getIsNonblock() == false)
+			client.setIsNonblock(true);
+		__atomic_store_n(&accepted, accepted + 1, __ATOMIC_RELAXED);
+		handler->onAccept(*loop, client);
+	}
+}
+
+/**
+ * @brief Unused, listeners are only monitored for E_IN.
+ *
+ * @param fd Listening socket descriptor (unused).
+ */
+void	ShardedTcpServer::Listener::onWrite(int fd)
+{
+	(void)fd;
+}
+
+/**
+ * @brief Unused, accept errors are reported by onRead().
+ *
+ * @param fd Listening socket descriptor (unused).
+ */
+void	ShardedTcpServer::Listener::onError(int fd)
+{
+	(void)fd;
+}
+
+} // !net
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
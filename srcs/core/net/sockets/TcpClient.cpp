@@ -86,6 +86,27 @@ void	TcpClient::connect(const struct sockaddr *addr, socklen_t addrlen)
 		throw std::runtime_error("connect failed: " + std::string(std::strerror(errno)));
 }
 
+/**
+ * @brief Sets the busy poll time of the socket (SO_BUSY_POLL).
+ *
+ * Raising the value above the system default needs CAP_NET_ADMIN on
+ * Linux.
+ *
+ * @param usec Microseconds to busy poll on receive, 0 to disable.
+ * @return false if the platform has no SO_BUSY_POLL.
+ * @throw std::runtime_error If setsockopt fails.
+ */
+bool	TcpClient::setBusyPoll(int usec)
+{
+#if defined(SO_BUSY_POLL)
+	setsockopt(SO_BUSY_POLL, usec);
+	return (true);
+#else
+	(void)usec;
+	return (false);
+#endif
+}
+
 } // !net
 } // !core
 } // !common
@@ -0,0 +1,196 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Histogram.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: pdemont <pdemont@student.42lausanne.ch>    +#+  +:+       +#+        */
+/*   By: blucken <blucken@student.42lausanne.ch>  +#+#+#+#+#+   +#+           */
+/*                                                     #+#    #+#             */
+/*   Created: 2026/10/17                              ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <common/core/utils/Histogram.hpp>
+#include <cstddef>
+
+/**
+ * @file Histogram.cpp
+ * @brief Implementation of the log2 histogram.
+ */
+
+namespace common
+{
+namespace core
+{
+namespace utils
+{
+
+const std::size_t	Histogram::BUCKETS;
+
+/**
+ * @brief Constructor. Creates an empty histogram.
+ */
+Histogram::Histogram() : _count(0), _sum(0), _max(0)
+{
+	for (std::size_t i = 0; i < BUCKETS; ++i)
+		_buckets[i] = 0;
+}
+
+/**
+ * @brief Destructor.
+ */
+Histogram::~Histogram() {}
+
+/**
+ * @brief Constructor. Creates an empty snapshot.
+ */
+Histogram::Snapshot::Snapshot() : count(0), sum(0), max(0)
+{
+	for (std::size_t i = 0; i < BUCKETS; ++i)
+		buckets[i] = 0;
+}
+
+/**
+ * @brief Adds a sample. Only one thread may record at a time.
+ *
+ * The owner is the only writer, so each counter is updated with a
+ * relaxed load and store instead of a locked read-modify-write.
+ *
+ * @param value Sample to add.
+ */
+void	Histogram::record(unsigned long value)
+{
+	unsigned long *bucket = &_buckets[bucketOf(value)];
+
+	__atomic_store_n(bucket, __atomic_load_n(bucket, __ATOMIC_RELAXED) + 1, __ATOMIC_RELAXED);
+	__atomic_store_n(&_count, _count + 1, __ATOMIC_RELAXED);
+	__atomic_store_n(&_sum, _sum + value, __ATOMIC_RELAXED);
+	if (value > _max)
+		__atomic_store_n(&_max, value, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Copies the histogram. Safe from any thread.
+ *
+ * Counters are read one by one while samples may still be recorded, so
+ * the copy is only consistent to within the samples added meanwhile.
+ *
+ * @return Copy of the buckets and totals.
+ */
+Histogram::Snapshot	Histogram::snapshot() const
+{
+	Snapshot snap;
+
+	for (std::size_t i = 0; i < BUCKETS; ++i)
+		snap.buckets[i] = __atomic_load_n(&_buckets[i], __ATOMIC_RELAXED);
+	snap.count = __atomic_load_n(&_count, __ATOMIC_RELAXED);
+	snap.sum = __atomic_load_n(&_sum, __ATOMIC_RELAXED);
+	snap.max = __atomic_load_n(&_max, __ATOMIC_RELAXED);
+	return (snap);
+}
+
+/**
+ * @brief Gets the bucket of a value.
+ *
+ * @param value Sample.
+ * @return 0 for 0, else 1 + floor(log2(value)), capped to BUCKETS - 1.
+ */
+std::size_t	Histogram::bucketOf(unsigned long value)
+{
+	std::size_t bucket;
+
+	if (value == 0)
+		return (0);
+	bucket = sizeof(unsigned long) * 8 - static_cast<std::size_t>(__builtin_clzl(value));
+	return (bucket < BUCKETS ? bucket : BUCKETS - 1);
+}
+
+/**
+ * @brief Gets the average sample.
+ *
+ * @return Mean, 0 if there is no sample.
+ */
+unsigned long	Histogram::Snapshot::mean() const
+{
+	return (count ? sum / count : 0);
+}
+
+/**
+ * @brief Estimates a percentile from the buckets.
+ *
+ * The answer is the upper bound of the bucket holding the percentile,
+ * capped to the largest sample, so it overestimates by less than 2x.
+ *
+ * @param p Percentile, between 0 and 100.
+ * @return Estimated value, 0 if there is no sample.
+ */
+unsigned long	Histogram::Snapshot::percentile(double p) const
+{
+	unsigned long rank;
+	unsigned long seen = 0;
+
+	if (count == 0)
+		return (0);
+	rank = static_cast<unsigned long>(p / 100.0 * static_cast<double>(count) + 0.5);
+	if (rank == 0)
+		rank = 1;
+	for (std::size_t i = 0; i < BUCKETS; ++i)
+	{
+		seen += buckets[i];
+		if (seen >= rank)
+		{
+			if (i == 0)
+				return (0);
+			if (i == BUCKETS - 1 || (1UL << i) - 1 > max)
+				return (max);
+			return ((1UL << i) - 1);
+		}
+	}
+	return (max);
+}
+
+/**
+ * @brief Adds the samples of another snapshot, e.g. of another thread.
+ *
+ * @param other Snapshot to add.
+ */
+void	Histogram::Snapshot::merge(const Snapshot &other)
+{
+	for (std::size_t i = 0; i < BUCKETS; ++i)
+		buckets[i] += other.buckets[i];
+	count += other.count;
+	sum += other.sum;
+	if (other.max > max)
+		max = other.max;
+}
+
+} // !utils
+} // !core
+} // !common
+
+/* ************************************************************************** */
+/*                                                                            */
+/*                                MIT License                                 */
+/*                                                                            */
+/*   Copyright (c) 2026 Demont Pieric, Lucken Bénédict                        */
+/*                                                                            */
+/*   Permission is hereby granted, free of charge, to any person obtaining    */
+/*   a copy of this software and associated documentation files (the          */
+/*   "Software"), to deal in the Software without restriction, including      */
+/*   without limitation the rights to use, copy, modify, merge, publish,      */
+/*   distribute, sublicense, and/or sell copies of the Software, and to       */
+/*   permit persons to whom the Software is furnished to do so, subject to    */
+/*   the following conditions:                                                */
+/*                                                                            */
+/*   The above copyright notice and this permission notice shall be included  */
+/*   in all copies or substantial portions of the Software.                   */
+/*                                                                            */
+/*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS  */
+/*   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF               */
+/*   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.   */
+/*   IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY     */
+/*   CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,     */
+/*   TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE        */
+/*   SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                   */
+/*                                                                            */
+/* ************************************************************************** */
@@ -49,6 +49,57 @@ long	nowMilli()
 	return (tv.tv_usec / 1000);
 }
 
+/**
+ * @brief Get a monotonic time in milliseconds.
+ *
+ * Unaffected by changes of the wall clock, meant for measuring intervals
+ * and scheduling deadlines. The origin is unspecified and the value wraps
+ * around, so only differences between two values are meaningful.
+ *
+ * @return Monotonic time in milliseconds.
+ */
+unsigned long	monotonicMilli()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (static_cast<unsigned long>(ts.tv_sec) * 1000UL
+		+ static_cast<unsigned long>(ts.tv_nsec) / 1000000UL);
+}
+
+/**
+ * @brief Get a monotonic time in microseconds.
+ *
+ * Same clock as monotonicMilli(), for measuring short intervals.
+ *
+ * @return Monotonic time in microseconds.
+ */
+unsigned long	monotonicMicro()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (static_cast<unsigned long>(ts.tv_sec) * 1000000UL
+		+ static_cast<unsigned long>(ts.tv_nsec) / 1000UL);
+}
+
+/**
+ * @brief Get a monotonic time in nanoseconds.
+ *
+ * Same clock as monotonicMilli(), for timing work that lasts less than a
+ * microsecond.
+ *
+ * @return Monotonic time in nanoseconds.
+ */
+unsigned long	monotonicNano()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (static_cast<unsigned long>(ts.tv_sec) * 1000000000UL
+		+ static_cast<unsigned long>(ts.tv_nsec));
+}
+
 /**
  * @brief Get the elapsed time in seconds since a given clock tick.
  *